@@ -0,0 +1,75 @@
+/**
+ * @file
+ * @brief Host replacement for <ti/real.h>
+ *
+ * Declares the same real_t layout and os_Real* entry points as the
+ * calculator header, implemented in host/src/real.cpp, so that code using
+ * <ti/real> can be compiled and run natively.
+ */
+
+#ifndef TI_REAL_H
+#define TI_REAL_H
+
+#include <stdint.h>
+
+/* The eZ80 has native 24-bit integers; the host widens them to 32 bits */
+typedef int32_t int24_t;
+typedef uint32_t uint24_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Structure of real variable type
+ */
+typedef struct { int8_t sign, exp; uint8_t mant[7]; } real_t;
+
+real_t os_RealCopy(const real_t *src);
+
+real_t os_RealAcosRad(const real_t *arg);
+real_t os_RealAsinRad(const real_t *arg);
+real_t os_RealAtanRad(const real_t *arg);
+real_t os_RealCosRad(const real_t *arg);
+real_t os_RealRadToDeg(const real_t *arg);
+real_t os_RealExp(const real_t *arg);
+real_t os_RealFloor(const real_t *arg);
+real_t os_RealFrac(const real_t *arg);
+real_t os_RealRoundInt(const real_t *arg);
+real_t os_RealNeg(const real_t *arg);
+real_t os_RealInv(const real_t *arg);
+real_t os_RealLog(const real_t *arg);
+real_t os_RealDegToRad(const real_t *arg);
+real_t os_RealSinRad(const real_t *arg);
+real_t os_RealSqrt(const real_t *arg);
+real_t os_RealTanRad(const real_t *arg);
+real_t os_RealInt(const real_t *arg);
+
+real_t os_RealAdd(const real_t *arg1, const real_t *arg2);
+real_t os_RealSub(const real_t *arg1, const real_t *arg2);
+real_t os_RealMul(const real_t *arg1, const real_t *arg2);
+real_t os_RealDiv(const real_t *arg1, const real_t *arg2);
+real_t os_RealMod(const real_t *arg1, const real_t *arg2);
+real_t os_RealMax(const real_t *arg1, const real_t *arg2);
+real_t os_RealMin(const real_t *arg1, const real_t *arg2);
+real_t os_RealGcd(const real_t *arg1, const real_t *arg2);
+real_t os_RealLcm(const real_t *arg1, const real_t *arg2);
+real_t os_RealNcr(const real_t *total, const real_t *num);
+real_t os_RealNpr(const real_t *total, const real_t *num);
+real_t os_RealPow(const real_t *base, const real_t *exp);
+
+real_t os_RealRound(const real_t *arg, char digits);
+int os_RealCompare(const real_t *arg1, const real_t *arg2);
+
+int24_t os_RealToInt24(const real_t *arg);
+real_t os_Int24ToReal(int24_t arg);
+float os_RealToFloat(const real_t *arg);
+real_t os_FloatToReal(float arg);
+int os_RealToStr(char *result, const real_t *arg, int8_t maxLength, uint8_t mode, int8_t digits);
+real_t os_StrToReal(const char *string, char **end);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
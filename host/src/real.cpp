@@ -0,0 +1,545 @@
+/*
+ * Host implementation of the os_Real* routines declared in
+ * host/include/ti/real.h.
+ *
+ * Addition, subtraction, multiplication, division, the integer part
+ * routines, rounding, comparison and int24_t conversion work directly on
+ * the 14 BCD digits: the exact result is computed in a 128-bit integer and
+ * rounded half away from zero to 14 significant digits, the way the OS
+ * rounds OP1 when it is stored back into a 9-byte real. Exponents past
+ * +/-99 saturate instead of raising ERR:OVERFLOW.
+ *
+ * The transcendental and combinatoric routines go through long double and
+ * are only accurate to about the last digit; calconv does not use them.
+ */
+
+#include <ti/real.h>
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define EXPONENT_BIAS 0x80
+#define SIGN_NEG 0x80
+#define DIGITS 14
+#define MAX_EXPONENT 99
+
+typedef unsigned __int128 uint128_t;
+
+// A real_t unpacked to sign, exponent and a 14 digit integer mantissa:
+// value = mant * 10^(exp - 13), with mant == 0 only for zero
+
+struct decimal
+{
+    bool negative;
+    int exp;
+    uint64_t mant;
+};
+
+// Powers of ten up to 10^38, the largest that fits in 128 bits
+
+#define POW10_COUNT 39
+
+static uint128_t pow10_table[POW10_COUNT];
+
+static void init_pow10_table()
+{
+    if (pow10_table[0] == 0)
+    {
+        pow10_table[0] = 1;
+        for (int i = 1; i < POW10_COUNT; i++)
+        {
+            pow10_table[i] = pow10_table[i - 1] * 10;
+        }
+    }
+}
+
+static uint128_t pow10(int n)
+{
+    init_pow10_table();
+    return pow10_table[n];
+}
+
+static int count_digits(uint128_t value)
+{
+    init_pow10_table();
+
+    int digits = 0;
+    while (digits < POW10_COUNT && value >= pow10_table[digits])
+    {
+        digits++;
+    }
+    return digits;
+}
+
+static decimal unpack(const real_t *r)
+{
+    decimal d;
+
+    d.mant = 0;
+    for (int i = 0; i < DIGITS; i++)
+    {
+        uint8_t pair = r->mant[i / 2];
+        d.mant = d.mant * 10 + ((i & 1) ? (pair & 0x0F) : (pair >> 4));
+    }
+    d.negative = (r->sign & SIGN_NEG) && d.mant != 0;
+    d.exp = static_cast<uint8_t>(r->exp) - EXPONENT_BIAS;
+
+    return d;
+}
+
+// Round value * 10^scale to 14 significant digits and pack it
+
+static real_t pack(bool negative, uint128_t value, int scale)
+{
+    real_t r;
+    int digits = count_digits(value);
+
+    memset(&r, 0, sizeof r);
+    r.exp = static_cast<int8_t>(EXPONENT_BIAS);
+    if (value == 0)
+    {
+        return r;
+    }
+
+    if (digits > DIGITS)
+    {
+        // Keep one guard digit, then round half away from zero on it
+        value /= pow10(digits - DIGITS - 1);
+        value = (value + 5) / 10;
+        scale += digits - DIGITS;
+        if (value == pow10(DIGITS))
+        {
+            value /= 10;
+            scale++;
+        }
+    }
+    else
+    {
+        value *= pow10(DIGITS - digits);
+        scale -= DIGITS - digits;
+    }
+
+    int exponent = scale + DIGITS - 1;
+    if (exponent < -MAX_EXPONENT)
+    {
+        return r;
+    }
+    if (exponent > MAX_EXPONENT)
+    {
+        value = pow10(DIGITS) - 1;
+        exponent = MAX_EXPONENT;
+    }
+
+    uint64_t mant = static_cast<uint64_t>(value);
+    for (int i = DIGITS - 1; i >= 0; i--, mant /= 10)
+    {
+        r.mant[i / 2] |= (mant % 10) << ((i & 1) ? 0 : 4);
+    }
+    r.sign = negative ? static_cast<int8_t>(SIGN_NEG) : 0;
+    r.exp = static_cast<int8_t>(exponent + EXPONENT_BIAS);
+
+    return r;
+}
+
+static real_t pack(const decimal &d)
+{
+    return pack(d.negative, d.mant, d.exp - (DIGITS - 1));
+}
+
+// Signed sum of two decimals; a tiny addend more than 20 digits below the
+// other cannot move the rounded result, so it is dropped
+
+static real_t add(decimal a, decimal b)
+{
+    if (b.mant == 0)
+    {
+        return pack(a);
+    }
+    if (a.mant == 0)
+    {
+        return pack(b);
+    }
+    if (a.exp < b.exp)
+    {
+        decimal t = a;
+        a = b;
+        b = t;
+    }
+
+    int shift = a.exp - b.exp;
+    if (shift > DIGITS + 6)
+    {
+        return pack(a);
+    }
+
+    uint128_t big = a.mant * pow10(shift);
+    uint128_t small = b.mant;
+    int scale = b.exp - (DIGITS - 1);
+
+    if (a.negative == b.negative)
+    {
+        return pack(a.negative, big + small, scale);
+    }
+    if (big >= small)
+    {
+        return pack(a.negative, big - small, scale);
+    }
+    return pack(b.negative, small - big, scale);
+}
+
+// Digits of d below the decimal point, or -1 if |d| < 1
+
+static int fraction_digits(const decimal &d)
+{
+    if (d.exp < 0)
+    {
+        return -1;
+    }
+    return (d.exp >= DIGITS - 1) ? 0 : (DIGITS - 1 - d.exp);
+}
+
+// Truncate toward zero, optionally stepping away from zero if a fraction
+// was dropped (floor of a negative number)
+
+static real_t truncate(const real_t *arg, bool away_if_fraction)
+{
+    decimal d = unpack(arg);
+    int frac = fraction_digits(d);
+
+    if (frac == 0)
+    {
+        return *arg;
+    }
+    if (frac < 0)
+    {
+        return pack(d.negative, (away_if_fraction && d.mant != 0) ? 1 : 0, 0);
+    }
+
+    uint64_t unit = static_cast<uint64_t>(pow10(frac));
+    uint64_t whole = d.mant / unit;
+    if (away_if_fraction && d.mant % unit != 0)
+    {
+        whole++;
+    }
+    return pack(d.negative, whole, 0);
+}
+
+// Round to the given number of decimal places, half away from zero
+
+static real_t round_places(const real_t *arg, int places)
+{
+    decimal d = unpack(arg);
+    int drop = (DIGITS - 1 - d.exp) - places;
+
+    if (d.mant == 0 || drop <= 0)
+    {
+        return *arg;
+    }
+    if (drop > DIGITS)
+    {
+        return pack(false, 0, 0);
+    }
+
+    uint128_t unit = pow10(drop);
+    return pack(d.negative, (d.mant + unit / 2) / unit, -places);
+}
+
+// Approximate conversions for the routines without an exact implementation
+
+static long double decode(const real_t *r)
+{
+    decimal d = unpack(r);
+    long double value = d.mant * powl(10, d.exp - (DIGITS - 1));
+    return d.negative ? -value : value;
+}
+
+static real_t encode(long double value)
+{
+    char buf[32];
+
+    if (value == 0 || !isfinite(value))
+    {
+        return pack(false, 0, 0);
+    }
+
+    // "d.dddddddddddddddd" with three digits past the 14 kept, for pack()
+    // to round
+    snprintf(buf, sizeof buf, "%.*Le", DIGITS + 2, fabsl(value));
+
+    uint128_t mant = 0;
+    for (const char *digit = buf; *digit != 'e'; digit++)
+    {
+        if (*digit != '.')
+        {
+            mant = mant * 10 + (*digit - '0');
+        }
+    }
+    int exponent = atoi(strchr(buf, 'e') + 1);
+
+    return pack(value < 0, mant, exponent - (DIGITS + 2));
+}
+
+real_t os_RealCopy(const real_t *src)
+{
+    return *src;
+}
+
+#define UNARY(name, expr)               \
+    real_t os_Real##name(const real_t *arg) \
+    {                                       \
+        long double x = decode(arg);        \
+        return encode(expr);                \
+    }
+
+UNARY(AcosRad, acosl(x))
+UNARY(AsinRad, asinl(x))
+UNARY(AtanRad, atanl(x))
+UNARY(CosRad, cosl(x))
+UNARY(RadToDeg, x * 180 / M_PI)
+UNARY(Exp, expl(x))
+UNARY(Log, logl(x))
+UNARY(DegToRad, x * M_PI / 180)
+UNARY(SinRad, sinl(x))
+UNARY(Sqrt, sqrtl(x))
+UNARY(TanRad, tanl(x))
+
+#undef UNARY
+
+real_t os_RealFloor(const real_t *arg)
+{
+    return truncate(arg, unpack(arg).negative);
+}
+
+real_t os_RealFrac(const real_t *arg)
+{
+    real_t whole = os_RealInt(arg);
+    return os_RealSub(arg, &whole);
+}
+
+real_t os_RealRoundInt(const real_t *arg)
+{
+    return round_places(arg, 0);
+}
+
+real_t os_RealNeg(const real_t *arg)
+{
+    decimal d = unpack(arg);
+    d.negative = !d.negative && d.mant != 0;
+    return pack(d);
+}
+
+real_t os_RealInv(const real_t *arg)
+{
+    real_t one = os_Int24ToReal(1);
+    return os_RealDiv(&one, arg);
+}
+
+real_t os_RealInt(const real_t *arg)
+{
+    return truncate(arg, false);
+}
+
+real_t os_RealAdd(const real_t *arg1, const real_t *arg2)
+{
+    return add(unpack(arg1), unpack(arg2));
+}
+
+real_t os_RealSub(const real_t *arg1, const real_t *arg2)
+{
+    decimal b = unpack(arg2);
+    b.negative = !b.negative && b.mant != 0;
+    return add(unpack(arg1), b);
+}
+
+real_t os_RealMul(const real_t *arg1, const real_t *arg2)
+{
+    decimal a = unpack(arg1), b = unpack(arg2);
+    return pack(a.negative != b.negative, static_cast<uint128_t>(a.mant) * b.mant,
+                a.exp + b.exp - 2 * (DIGITS - 1));
+}
+
+real_t os_RealDiv(const real_t *arg1, const real_t *arg2)
+{
+    decimal a = unpack(arg1), b = unpack(arg2);
+
+    if (b.mant == 0)
+    {
+        // ERR:DIVIDE BY 0 on the calculator
+        return pack(a.negative, pow10(DIGITS) - 1, MAX_EXPONENT);
+    }
+
+    // At least 17 quotient digits, so the digit pack() rounds on is exact
+    const int extra = DIGITS + 3;
+    return pack(a.negative != b.negative, a.mant * pow10(extra) / b.mant, a.exp - b.exp - extra);
+}
+
+real_t os_RealMod(const real_t *arg1, const real_t *arg2)
+{
+    real_t quotient = os_RealDiv(arg1, arg2);
+    real_t whole = os_RealInt(&quotient);
+    real_t product = os_RealMul(&whole, arg2);
+    return os_RealSub(arg1, &product);
+}
+
+real_t os_RealMax(const real_t *arg1, const real_t *arg2)
+{
+    return (os_RealCompare(arg1, arg2) < 0) ? *arg2 : *arg1;
+}
+
+real_t os_RealMin(const real_t *arg1, const real_t *arg2)
+{
+    return (os_RealCompare(arg1, arg2) > 0) ? *arg2 : *arg1;
+}
+
+real_t os_RealGcd(const real_t *arg1, const real_t *arg2)
+{
+    long double a = fabsl(decode(arg1)), b = fabsl(decode(arg2));
+    while (b != 0)
+    {
+        long double t = fmodl(a, b);
+        a = b;
+        b = t;
+    }
+    return encode(a);
+}
+
+real_t os_RealLcm(const real_t *arg1, const real_t *arg2)
+{
+    long double a = fabsl(decode(arg1)), b = fabsl(decode(arg2));
+    real_t gcd = os_RealGcd(arg1, arg2);
+    return encode((a == 0 || b == 0) ? 0 : a / decode(&gcd) * b);
+}
+
+real_t os_RealNpr(const real_t *total, const real_t *num)
+{
+    long double n = decode(total), r = decode(num), result = 1;
+    for (long double i = 0; i < r; i++)
+    {
+        result *= n - i;
+    }
+    return encode(result);
+}
+
+real_t os_RealNcr(const real_t *total, const real_t *num)
+{
+    long double n = decode(total), r = decode(num), result = 1;
+    for (long double i = 1; i <= r; i++)
+    {
+        result = result * (n - r + i) / i;
+    }
+    return encode(roundl(result));
+}
+
+real_t os_RealPow(const real_t *base, const real_t *exp)
+{
+    return encode(powl(decode(base), decode(exp)));
+}
+
+real_t os_RealRound(const real_t *arg, char digits)
+{
+    return round_places(arg, digits);
+}
+
+int os_RealCompare(const real_t *arg1, const real_t *arg2)
+{
+    decimal a = unpack(arg1), b = unpack(arg2);
+
+    if (a.negative != b.negative)
+    {
+        return a.negative ? -1 : 1;
+    }
+
+    int magnitude;
+    if (a.mant == 0 || b.mant == 0)
+    {
+        magnitude = (a.mant != 0) - (b.mant != 0);
+    }
+    else if (a.exp != b.exp)
+    {
+        magnitude = (a.exp > b.exp) ? 1 : -1;
+    }
+    else
+    {
+        magnitude = (a.mant > b.mant) - (a.mant < b.mant);
+    }
+    return a.negative ? -magnitude : magnitude;
+}
+
+int24_t os_RealToInt24(const real_t *arg)
+{
+    real_t whole = os_RealInt(arg);
+    decimal d = unpack(&whole);
+    int frac = fraction_digits(d);
+
+    if (frac < 0)
+    {
+        return 0;
+    }
+    if (d.exp > 7)
+    {
+        return d.negative ? -0x800000 : 0x7FFFFF;
+    }
+
+    int32_t value = static_cast<int32_t>(d.mant / static_cast<uint64_t>(pow10(frac)));
+    if (d.negative)
+    {
+        return (value > 0x800000) ? -0x800000 : -value;
+    }
+    return (value > 0x7FFFFF) ? 0x7FFFFF : value;
+}
+
+real_t os_Int24ToReal(int24_t arg)
+{
+    return pack(arg < 0, (arg < 0) ? -static_cast<int64_t>(arg) : arg, 0);
+}
+
+float os_RealToFloat(const real_t *arg)
+{
+    return static_cast<float>(decode(arg));
+}
+
+real_t os_FloatToReal(float arg)
+{
+    return encode(arg);
+}
+
+// The calculator writes the TI-ASCII negative sign rather than '-', for the
+// number and its exponent alike, and reads either one back
+#define TI_NEGATIVE '\x1A'
+
+int os_RealToStr(char *result, const real_t *arg, int8_t maxLength, uint8_t /*mode*/, int8_t digits)
+{
+    if (maxLength <= 0)
+    {
+        maxLength = DIGITS;
+    }
+    int length = (digits < 0) ? snprintf(result, maxLength + 1, "%.*Lg", DIGITS, decode(arg))
+                              : snprintf(result, maxLength + 1, "%.*Lf", digits, decode(arg));
+    for (char *c = result; (c = strchr(c, '-')); c++)
+    {
+        *c = TI_NEGATIVE;
+    }
+    return length;
+}
+
+real_t os_StrToReal(const char *string, char **end)
+{
+    char ascii[64];
+    size_t length = strnlen(string, sizeof ascii - 1);
+    memcpy(ascii, string, length);
+    ascii[length] = '\0';
+    for (char *c = ascii; (c = strchr(c, TI_NEGATIVE)); c++)
+    {
+        *c = '-';
+    }
+
+    char *ascii_end;
+    real_t value = encode(strtold(ascii, &ascii_end));
+    if (end)
+    {
+        *end = const_cast<char *>(string) + (ascii_end - ascii);
+    }
+    return value;
+}
@@ -0,0 +1,279 @@
+/*
+ *--------------------------------------
+ * Program Name: CALCONV
+ * Author: Tomi Chen
+ * License: MIT
+ * Description: Host benchmark for the calendar converters.
+ *
+ * Times JD -> calendar -> JD round trips for every calendar and counts
+ * round trips that do not come back to the starting day. Then walks day by
+ * day through the year/month/day calendars, converting every day in full
+ * and with a date_cursor, and checks the cursor against the conversions
+ * after single days and after jumps of days and months in both directions.
+ * Finally round-trips the days at both ends of the integer kernel's range
+ * and checks that invalid Chinese dates are rejected.
+ *--------------------------------------
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "bcd.h"
+#include "calendar.h"
+#include "calendar_int.h"
+#include "chinese.h"
+
+using namespace ti::literals;
+
+// 1 CE to 2500 CE, walked with a stride coprime to its length
+#define FIRST_JDN 1721426
+#define JDN_COUNT 913125
+#define JDN_STRIDE 7919
+
+// The Chinese table only covers 1930 to 2100
+#define CHINESE_FIRST_JDN 2426007
+#define CHINESE_JDN_COUNT 62456
+
+// Days round-tripped at each end of the integer kernel's range
+#define EDGE_DAYS 5000
+
+struct calendar
+{
+    const char *name;
+    void (*from_jd)(ti::real jd, real_t *result);
+    ti::real (*to_jd)(const real_t *date);
+    int32_t first_jdn;
+    int32_t jdn_count;
+};
+
+static ti::real gregorian_date_to_jd(const real_t *date) { return gregorian_to_jd(date[0], date[1], date[2]); }
+static ti::real julian_date_to_jd(const real_t *date) { return julian_to_jd(date[0], date[1], date[2]); }
+static ti::real hebrew_date_to_jd(const real_t *date) { return hebrew_to_jd(date[0], date[1], date[2]); }
+static ti::real islamic_date_to_jd(const real_t *date) { return islamic_to_jd(date[0], date[1], date[2]); }
+static ti::real persian_date_to_jd(const real_t *date) { return persian_to_jd(date[0], date[1], date[2]); }
+static ti::real mayan_date_to_jd(const real_t *date) { return mayan_count_to_jd(date[0], date[1], date[2], date[3], date[4]); }
+static ti::real indian_civil_date_to_jd(const real_t *date) { return indian_civil_to_jd(date[0], date[1], date[2]); }
+static ti::real chinese_date_to_jd(const real_t *date) { return chinese_to_jd(date[0], date[1], date[2], date[3]); }
+
+static const calendar calendars[] = {
+    {"gregorian", jd_to_gregorian, gregorian_date_to_jd, FIRST_JDN, JDN_COUNT},
+    {"julian", jd_to_julian, julian_date_to_jd, FIRST_JDN, JDN_COUNT},
+    {"hebrew", jd_to_hebrew, hebrew_date_to_jd, FIRST_JDN, JDN_COUNT},
+    {"islamic", jd_to_islamic, islamic_date_to_jd, FIRST_JDN, JDN_COUNT},
+    {"persian", jd_to_persian, persian_date_to_jd, FIRST_JDN, JDN_COUNT},
+    {"mayan", jd_to_mayan_count, mayan_date_to_jd, FIRST_JDN, JDN_COUNT},
+    {"indian_civil", jd_to_indian_civil, indian_civil_date_to_jd, FIRST_JDN, JDN_COUNT},
+    {"chinese", jd_to_chinese, chinese_date_to_jd, CHINESE_FIRST_JDN, CHINESE_JDN_COUNT},
+};
+
+struct cursor_calendar
+{
+    const char *name;
+    uint8_t id;
+    void (*from_jdn)(int32_t jdn, int32_t result[3]);
+};
+
+static const cursor_calendar cursor_calendars[] = {
+    {"gregorian", CURSOR_GREGORIAN, jdn_to_gregorian},
+    {"julian", CURSOR_JULIAN, jdn_to_julian},
+    {"hebrew", CURSOR_HEBREW, jdn_to_hebrew},
+    {"islamic", CURSOR_ISLAMIC, jdn_to_islamic},
+    {"persian", CURSOR_PERSIAN, jdn_to_persian},
+    {"indian_civil", CURSOR_INDIAN_CIVIL, jdn_to_indian_civil},
+};
+
+// The cursor's date and month length agree with a full conversion
+static bool cursor_matches(const cursor_calendar &cal, const date_cursor &cursor)
+{
+    int32_t date[3], last[3], next[3];
+    int32_t month_start = cursor.jdn - cursor.date[2] + 1;
+
+    cal.from_jdn(cursor.jdn, date);
+    cal.from_jdn(month_start + cursor.month_length - 1, last);
+    cal.from_jdn(month_start + cursor.month_length, next);
+    return date[0] == cursor.date[0] && date[1] == cursor.date[1] && date[2] == cursor.date[2] &&
+           last[1] == date[1] && last[2] == cursor.month_length && next[2] == 1;
+}
+
+template <typename F>
+static double time_ns(long steps, F step)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < steps; i++)
+    {
+        step(i);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / steps;
+}
+
+static int scan(long steps)
+{
+    int failures = 0;
+    volatile int32_t sink = 0;
+
+    printf("\n%-14s %10s %14s %14s %10s\n", "calendar", "days", "ns/day full", "ns/day cursor", "mismatches");
+
+    for (const cursor_calendar &cal : cursor_calendars)
+    {
+        long mismatches = 0;
+        date_cursor cursor;
+
+        double full = time_ns(steps, [&](long i) {
+            int32_t date[3];
+            cal.from_jdn(FIRST_JDN + i % JDN_COUNT, date);
+            sink = date[2];
+        });
+
+        cursor_set(&cursor, cal.id, FIRST_JDN);
+        double incremental = time_ns(steps, [&](long) {
+            cursor_add_days(&cursor, 1);
+            sink = cursor.date[2];
+        });
+
+        // Check every day of the walk, then jumps both ways
+        cursor_set(&cursor, cal.id, FIRST_JDN);
+        for (long i = 0; i < steps && i < JDN_COUNT; i++)
+        {
+            mismatches += !cursor_matches(cal, cursor);
+            cursor_add_days(&cursor, 1);
+        }
+        cursor_set(&cursor, cal.id, FIRST_JDN + JDN_COUNT / 2);
+        for (int32_t i = 0; i < 20000; i++)
+        {
+            int32_t day = cursor.date[2];
+            int32_t months = (i % 7) - 3;
+            cursor_add_months(&cursor, months);
+            mismatches += !cursor_matches(cal, cursor) ||
+                          cursor.date[2] != ((day < cursor.month_length) ? day : cursor.month_length);
+
+            int32_t jdn = cursor.jdn, days = (i * 37) % 201 - 100;
+            cursor_add_days(&cursor, days);
+            mismatches += !cursor_matches(cal, cursor) || cursor.jdn != jdn + days;
+        }
+
+        printf("%-14s %10ld %14.1f %14.1f %10ld\n", cal.name, steps, full, incremental, mismatches);
+        failures += (mismatches != 0);
+    }
+
+    return failures;
+}
+
+// Round trips of the last days within +-JDN_LIMIT, where the years and
+// products in the kernel are largest
+static int edges(void)
+{
+    int failures = 0;
+
+    printf("\n%-14s %10s %10s\n", "calendar", "edge days", "mismatches");
+
+    for (const calendar &cal : calendars)
+    {
+        if (cal.first_jdn == CHINESE_FIRST_JDN)
+        {
+            continue;
+        }
+
+        long mismatches = 0;
+        for (int32_t i = 0; i < 2 * EDGE_DAYS; i++)
+        {
+            int32_t jdn = (i % 2) ? -JDN_LIMIT + i / 2 : JDN_LIMIT - i / 2;
+            ti::real jd = bcd_pack(jdn * 10 - 5, 1);
+            real_t date[5];
+
+            cal.from_jd(jd, date);
+            mismatches += cal.to_jd(date) != jd;
+        }
+
+        printf("%-14s %10d %10ld\n", cal.name, 2 * EDGE_DAYS, mismatches);
+        failures += (mismatches != 0);
+    }
+
+    return failures;
+}
+
+// Every Chinese date that isn't in the table has to convert to 0: months
+// outside 1 to 12, a leap flag on a month that isn't leap, and days
+// outside the month
+static int chinese_invalid(void)
+{
+    long checked = 0, mismatches = 0;
+
+    for (uint16_t index = 0; index < chinese_years.year_count; index++)
+    {
+        int32_t year = chinese_years.first_year + index;
+        uint8_t leap_month = chinese_years.leap_months[index];
+
+        static const int32_t bad_months[] = {-1, 0, 13};
+        for (int32_t month : bad_months)
+        {
+            mismatches += chinese_to_jdn(year, month, false, 1) != 0;
+            checked++;
+        }
+        for (int32_t month = 1; month <= 12; month++)
+        {
+            for (int leap = 0; leap <= 1; leap++)
+            {
+                if (leap && month != leap_month)
+                {
+                    mismatches += chinese_to_jdn(year, month, true, 1) != 0;
+                    checked++;
+                    continue;
+                }
+
+                // Day 30 only exists if the day after day 29 is still in the month
+                int32_t next = chinese_to_jdn(year, month, leap, 29) + 1, date[4];
+                jdn_to_chinese(next, date);
+                mismatches += chinese_to_jdn(year, month, leap, 30) != ((date[3] == 30) ? next : 0);
+                mismatches += chinese_to_jdn(year, month, leap, 0) != 0;
+                mismatches += chinese_to_jdn(year, month, leap, 31) != 0;
+                checked += 3;
+            }
+        }
+    }
+
+    printf("\n%-14s %10s %10s\n", "calendar", "invalid", "mismatches");
+    printf("%-14s %10ld %10ld\n", "chinese", checked, mismatches);
+    return mismatches != 0;
+}
+
+int main(int argc, char **argv)
+{
+    long iterations = (argc > 1) ? atol(argv[1]) : 1000000;
+    int failures = 0;
+
+    printf("%-14s %10s %14s %10s\n", "calendar", "roundtrips", "ns/roundtrip", "mismatches");
+
+    for (const calendar &cal : calendars)
+    {
+        long mismatches = 0;
+        int32_t offset = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (long i = 0; i < iterations; i++)
+        {
+            ti::real jd = ti::real(static_cast<int24_t>(cal.first_jdn + offset)) - 0.5_r;
+            real_t date[5];
+
+            cal.from_jd(jd, date);
+            if (cal.to_jd(date) != jd)
+            {
+                mismatches++;
+            }
+
+            offset = (offset + JDN_STRIDE) % cal.jdn_count;
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+
+        double ns = std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+        printf("%-14s %10ld %14.1f %10ld\n", cal.name, iterations, ns, mismatches);
+        failures += (mismatches != 0);
+    }
+
+    failures += scan(iterations);
+    failures += edges();
+    failures += chinese_invalid();
+
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
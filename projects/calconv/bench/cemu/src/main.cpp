@@ -0,0 +1,182 @@
+/*
+ *--------------------------------------
+ * Program Name: CALBENCH
+ * Author: Tomi Chen
+ * License: MIT
+ * Description: Cycle counts for every ZCALCONV selection code.
+ *
+ * For each date, converts its JD to every calendar and back again through
+ * convert(), exactly as ZCALCONV does, timing each call with timer 1 on
+ * the CPU clock. The report is written as CSV to the CALBENCH AppVar and,
+ * in debug builds, to the emulator console.
+ *
+ * Every round trip also has to come back to the JD it started from. The
+ * result is printed on STATUS_ROW and copied to the home screen's text
+ * shadow, where the autotester checks it with a CRC.
+ *--------------------------------------
+ */
+
+#include <debug.h>
+#include <fileioc.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/timers.h>
+#include <ti/getcsc.h>
+#include <ti/screen.h>
+#include <ti/vars.h>
+
+#include "convert.h"
+
+#define REPORT_NAME "CALBENCH"
+
+// Home screen row of the round trip status, hashed by autotest.json
+#define STATUS_ROW 3
+#define SCREEN_COLUMNS 26
+
+// Julian Days (at noon) spread over the supported range, 1 CE to 2500 CE
+static const int24_t dates[] = {1721426, 2000000, 2299161, 2451545, 2460000, 2634167};
+
+#define DATE_COUNT (sizeof dates / sizeof dates[0])
+
+static const char *const calendars[] = {
+    "gregorian", "julian", "hebrew", "islamic", "persian", "mayan", "indian_civil", "chinese",
+};
+
+#define CALENDAR_COUNT (sizeof calendars / sizeof calendars[0])
+
+// Number of inputs each calendar's to-JD selection reads from [J]
+static const uint8_t date_fields[CALENDAR_COUNT] = {3, 3, 3, 3, 3, 5, 3, 4};
+
+// Index of the Chinese calendar, which only covers the years in its table
+#define CHINESE_CALENDAR 7
+
+static uint8_t report;
+static matrix_t *matrix;
+
+static void report_line(const char *line)
+{
+    ti_Write(line, strlen(line), 1, report);
+    dbg_printf("%s", line);
+}
+
+// Run selection with the inputs already in row 1 of [J], returning cycles
+
+static uint32_t time_convert(int24_t selection)
+{
+    matrix_row(matrix, 1)[0] = os_Int24ToReal(selection);
+
+    timer_Set(1, 0);
+    timer_Enable(1, TIMER_CPU, TIMER_NOINT, TIMER_UP);
+    convert(matrix, selection, 1, 2);
+    timer_Disable(1);
+
+    return timer_Get(1);
+}
+
+static void record(int24_t selection, uint8_t date, uint32_t cycles)
+{
+    char line[48];
+    sprintf(line, "%d,%s,%d,%lu\n", selection, calendars[selection / 2], dates[date],
+            (unsigned long)cycles);
+    report_line(line);
+}
+
+// The full row is copied, padded with spaces, so the CRC covers the same
+// bytes whatever was on that row before
+
+static void print_status(const char *status)
+{
+    char row[SCREEN_COLUMNS + 1];
+
+    memset(row, ' ', SCREEN_COLUMNS);
+    memcpy(row, status, strlen(status));
+    row[SCREEN_COLUMNS] = '\0';
+
+    os_SetCursorPos(STATUS_ROW, 0);
+    os_PutStrFull(row);
+    memcpy(&os_TextShadow[STATUS_ROW * SCREEN_COLUMNS], row, SCREEN_COLUMNS);
+}
+
+int main(void)
+{
+    os_ClrHome();
+    os_PutStrFull("Benchmarking...");
+
+    report = ti_Open(REPORT_NAME, "w");
+    if (!report)
+    {
+        return 1;
+    }
+    report_line("selection,calendar,jd,cycles\n");
+
+    os_SetMatrixDims(MATRIX, 2, 9);
+    matrix = open_matrix();
+    if (!matrix)
+    {
+        ti_Close(report);
+        return 1;
+    }
+
+    uint32_t total = 0;
+    uint24_t failures = 0;
+    for (uint8_t date = 0; date < DATE_COUNT; date++)
+    {
+        for (uint8_t calendar = 0; calendar < CALENDAR_COUNT; calendar++)
+        {
+            int24_t to_calendar = calendar * 2 + 1;
+            int24_t to_jd = calendar * 2;
+            real_t value;
+
+            // JD -> calendar, taking JD - 0.5 as the calendars do
+            value = os_Int24ToReal(dates[date]);
+            real_t half = os_FloatToReal(0.5f);
+            value = os_RealSub(&value, &half);
+            matrix_row(matrix, 1)[1] = value;
+
+            uint32_t cycles = time_convert(to_calendar);
+            record(to_calendar, date, cycles);
+            total += cycles;
+
+            // Calendar -> JD, feeding the result straight back in
+            memcpy(&matrix_row(matrix, 1)[1], matrix_row(matrix, 2), date_fields[calendar] * sizeof(real_t));
+
+            // Chinese dates outside the table convert to 0 both ways
+            real_t zero = os_Int24ToReal(0);
+            bool in_range = calendar != CHINESE_CALENDAR ||
+                            os_RealCompare(&matrix_row(matrix, 2)[0], &zero) != 0;
+
+            cycles = time_convert(to_jd);
+            record(to_jd, date, cycles);
+            total += cycles;
+
+            if (in_range && os_RealCompare(&matrix_row(matrix, 2)[0], &value) != 0)
+            {
+                failures++;
+            }
+        }
+    }
+
+    ti_Close(report);
+
+    char line[32];
+    sprintf(line, "%lu cycles", (unsigned long)total);
+    os_SetCursorPos(1, 0);
+    os_PutStrFull(line);
+    os_SetCursorPos(2, 0);
+    os_PutStrFull("Report in " REPORT_NAME);
+
+    if (failures == 0)
+    {
+        print_status("Round trips: OK");
+    }
+    else
+    {
+        sprintf(line, "Round trips: %u FAILED", failures);
+        print_status(line);
+    }
+
+    while (!os_GetCSC())
+        ;
+
+    return 0;
+}
@@ -0,0 +1,103 @@
+/*
+ *--------------------------------------
+ * Program Name: CALCONV
+ * Author: Tomi Chen
+ * License: MIT
+ * Description: Integer <-> real_t conversion without OS calls.
+ *--------------------------------------
+ */
+
+#include "bcd.h"
+
+#define REAL_EXPONENT_BIAS 0x80
+
+// Packed BCD byte for 0-99, so each division by 100 gives two digits
+
+#define BCD_ROW(tens) 0x##tens##0, 0x##tens##1, 0x##tens##2, 0x##tens##3, 0x##tens##4, \
+                      0x##tens##5, 0x##tens##6, 0x##tens##7, 0x##tens##8, 0x##tens##9
+
+static const uint8_t bcd_pairs[100] = {
+    BCD_ROW(0), BCD_ROW(1), BCD_ROW(2), BCD_ROW(3), BCD_ROW(4),
+    BCD_ROW(5), BCD_ROW(6), BCD_ROW(7), BCD_ROW(8), BCD_ROW(9),
+};
+
+#undef BCD_ROW
+
+real_t bcd_pack(int32_t value, uint8_t decimals)
+{
+    real_t result = {0, static_cast<int8_t>(REAL_EXPONENT_BIAS), {0}};
+    uint32_t magnitude = (value < 0) ? -static_cast<uint32_t>(value) : value;
+    uint8_t pairs[5]; // least significant first
+    uint8_t count = 0;
+
+    if (magnitude == 0)
+    {
+        return result;
+    }
+
+    // 32-bit division only while the value doesn't fit in a native int
+    while (magnitude > 0xFFFFFF)
+    {
+        uint32_t quotient = magnitude / 100;
+        pairs[count++] = bcd_pairs[magnitude - quotient * 100];
+        magnitude = quotient;
+    }
+    for (uint24_t rest = magnitude; rest != 0;)
+    {
+        uint24_t quotient = rest / 100;
+        pairs[count++] = bcd_pairs[rest - quotient * 100];
+        rest = quotient;
+    }
+
+    // The mantissa starts with the leading digit, so an odd digit count
+    // shifts every pair by one nibble.
+    bool odd = pairs[count - 1] < 0x10;
+    uint8_t digits = count * 2 - odd;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        uint8_t pair = pairs[count - 1 - i];
+        if (odd)
+        {
+            uint8_t next = (i + 1 < count) ? pairs[count - 2 - i] : 0;
+            pair = static_cast<uint8_t>(pair << 4 | next >> 4);
+        }
+        result.mant[i] = pair;
+    }
+
+    result.sign = (value < 0) ? static_cast<int8_t>(0x80) : 0;
+    result.exp = static_cast<int8_t>(REAL_EXPONENT_BIAS + digits - 1 - decimals);
+    return result;
+}
+
+bool bcd_unpack(const real_t *value, uint8_t decimals, int32_t *result)
+{
+    int exponent = static_cast<uint8_t>(value->exp) - REAL_EXPONENT_BIAS;
+    int digits = exponent + decimals + 1;
+    int32_t magnitude = 0;
+
+    if (value->mant[0] == 0)
+    {
+        *result = 0;
+        return true;
+    }
+    if (digits < 1 || digits > 9)
+    {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < 14; i++)
+    {
+        uint8_t digit = (i & 1) ? (value->mant[i / 2] & 0x0F) : (value->mant[i / 2] >> 4);
+        if (i < digits)
+        {
+            magnitude = magnitude * 10 + digit;
+        }
+        else if (digit != 0)
+        {
+            return false;
+        }
+    }
+
+    *result = (value->sign < 0) ? -magnitude : magnitude;
+    return true;
+}
@@ -0,0 +1,30 @@
+/*
+ *--------------------------------------
+ * Program Name: CALCONV
+ * Author: Tomi Chen
+ * License: MIT
+ * Description: Integer <-> real_t conversion without OS calls.
+ *
+ * Everything that crosses the matrix J boundary in the integer engine is a
+ * whole number or a JD ending in .5, so it is packed to and unpacked from
+ * BCD directly instead of going through os_Int24ToReal / os_RealToInt24
+ * and the OS floating point routines.
+ *--------------------------------------
+ */
+
+#ifndef BCD_H
+#define BCD_H
+
+#include <stdint.h>
+#include <ti/real.h>
+
+// value * 10^-decimals
+
+real_t bcd_pack(int32_t value, uint8_t decimals);
+
+// Stores value * 10^decimals in *result. Returns false if that is not a
+// whole number or has more than 9 digits, the caller then uses the OS.
+
+bool bcd_unpack(const real_t *value, uint8_t decimals, int32_t *result);
+
+#endif
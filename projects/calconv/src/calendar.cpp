@@ -0,0 +1,847 @@
+/*
+ *--------------------------------------
+ * Program Name: CALCONV
+ * Author: Tomi Chen
+ * License: MIT
+ * Description: Convert between different calendar systems.
+ *
+ * Calendar conversion functions adapted from Fourmilab's calendar converter
+ *--------------------------------------
+ */
+
+#include <string.h>
+
+#include "bcd.h"
+#include "calendar.h"
+#include "calendar_int.h"
+#include "chinese.h"
+
+using namespace ti::literals;
+
+// Whole numbers and JDs cross the matrix J boundary through bcd.h, the OS
+// is only used for values that aren't (a year typed as 2024.5, say). A
+// value too large for bcd.h comes back as INT32_MAX, outside every limit
+// in calendar_int.h.
+
+static int32_t to_int(ti::real value)
+{
+    real_t bcd = value;
+    int32_t result;
+    if (bcd_unpack(&bcd, 0, &result))
+    {
+        return result;
+    }
+    bcd = value.floor();
+    return bcd_unpack(&bcd, 0, &result) ? result : INT32_MAX;
+}
+
+static int32_t to_jdn(ti::real jd)
+{
+    real_t bcd = jd;
+    int32_t tenths, jdn;
+    if (bcd_unpack(&bcd, 1, &tenths))
+    {
+        return floor_div(tenths + 5, 10);
+    }
+    bcd = jd.add_floor(0.5_r);
+    return bcd_unpack(&bcd, 0, &jdn) ? jdn : INT32_MAX;
+}
+
+static ti::real from_jdn(int32_t jdn)
+{
+    return bcd_pack(jdn * 10 - 5, 1);
+}
+
+static void store(real_t *result, const int32_t *values, uint8_t count)
+{
+    for (uint8_t i = 0; i < count; i++)
+    {
+        result[i] = bcd_pack(values[i], 0);
+    }
+}
+
+const uint8_t all_calendar_widths[ALL_CALENDARS] = {3, 3, 3, 3, 3, 9, 3, 4};
+
+#ifndef CALCONV_ENGINE_INTEGER
+
+// Every calendar takes the day containing jd, which starts at the JD ending
+// in .5 at or before it (JDN = floor(jd + 0.5)), the same as to_jdn.
+
+static ti::real day_start(ti::real jd)
+{
+    return (jd - 0.5_r).floor() + 0.5_r;
+}
+
+// Gregorian
+
+#define GREGORIAN_EPOCH 1721425.5_r
+
+static constexpr ti::real GREGORIAN_EPOCH_MINUS_1 = ti::real::fold_sub(GREGORIAN_EPOCH, 1_r);
+
+bool leap_gregorian(ti::real year)
+{
+    return (year % 4_r == 0_r && (year % 100_r != 0_r || year % 400_r == 0_r));
+}
+
+ti::real gregorian_to_jd(ti::real year, ti::real month, ti::real day)
+{
+    ti::real y1 = year - 1_r;
+
+    return GREGORIAN_EPOCH_MINUS_1 +
+           (y1 * 365_r) +
+           y1.floor_div(4_r) -
+           y1.floor_div(100_r) +
+           y1.floor_div(400_r) +
+           ((month.fma(367_r, -362_r) / 12_r) +
+            ((month <= 2_r) ? 0_r : (leap_gregorian(year) ? -1_r : -2_r)))
+               .add_floor(day);
+}
+
+void jd_to_gregorian(ti::real jd, real_t result[3])
+{
+    ti::real wjd, depoch, quadricent, dqc, cent, dcent, quad, dquad,
+        yindex, year, yearday, leapadj, month, day;
+
+    wjd = day_start(jd);
+    depoch = wjd - GREGORIAN_EPOCH;
+    quadricent = depoch.divmod(146097_r, &dqc);
+    cent = dqc.divmod(36524_r, &dcent);
+    quad = dcent.divmod(1461_r, &dquad);
+    yindex = dquad.floor_div(365_r);
+    year = (quadricent * 400_r) + (cent * 100_r) + (quad * 4_r) + yindex;
+    if (!((cent == 4_r) || (yindex == 4_r)))
+    {
+        year++;
+    }
+    yearday = wjd - gregorian_to_jd(year, 1_r, 1_r);
+    leapadj = ((wjd < gregorian_to_jd(year, 3_r, 1_r)) ? 0_r
+                                                   : (leap_gregorian(year) ? 1_r : 2_r));
+    month = ((((yearday + leapadj) * 12_r) + 373_r) / 367_r).floor();
+    day = (wjd - gregorian_to_jd(year, month, 1_r)) + 1_r;
+
+    result[0] = year;
+    result[1] = month;
+    result[2] = day;
+}
+
+// Julian
+
+#define JULIAN_EPOCH 1721423.5_r
+
+bool leap_julian(ti::real year)
+{
+    return year.fmod(4_r) == ((year > 0_r) ? 0_r : 3_r);
+}
+
+ti::real julian_to_jd(ti::real year, ti::real month, ti::real day)
+{
+
+    /* Adjust negative common era years to the zero-based notation we use.  */
+
+    if (year < 1_r)
+    {
+        year++;
+    }
+
+    /* Algorithm as given in Meeus, Astronomical Algorithms, Chapter 7, page 61 */
+
+    if (month <= 2_r)
+    {
+        year--;
+        month += 12_r;
+    }
+
+    return (((((year + 4716_r) * 365.25_r)).floor() +
+             (((month + 1_r) * 30.6001_r)).floor() +
+             day) -
+            1524.5_r);
+}
+
+void jd_to_julian(ti::real jd, real_t result[3])
+{
+    ti::real z, a, b, c, d, e, year, month, day;
+
+    jd += 0.5_r;
+    z = jd.floor();
+
+    a = z;
+    b = a + 1524_r;
+    c = (b - 122.1_r).floor_div(365.25_r);
+    d = (c * 365.25_r).floor();
+    e = (b - d).floor_div(30.6001_r);
+
+    month = ((e < 14_r) ? (e - 1_r) : (e - 13_r)).floor();
+    year = ((month > 2_r) ? (c - 4716_r) : (c - 4715_r)).floor();
+    day = b - d - (e * 30.6001_r).floor();
+
+    /*  If year is less than 1, subtract one to convert from
+        a zero based date system to the common era system in
+        which the year -1 (1 B.C.E) is followed by year 1 (1 C.E.).  */
+
+    if (year < 1_r)
+    {
+        year--;
+    }
+
+    result[0] = year;
+    result[1] = month;
+    result[2] = day;
+}
+
+// Hebrew
+
+// #define HEBREW_EPOCH 347995.5_r
+
+// //  Is a given Hebrew year a leap year ?
+
+// bool hebrew_leap(ti::real year)
+// {
+//     return ((year * 7) + 1).fmod(19) < 7;
+// }
+
+// //  How many months are there in a Hebrew year (12 = normal, 13 = leap)
+
+// int hebrew_year_months(ti::real year)
+// {
+//     return hebrew_leap(year) ? 13 : 12;
+// }
+
+// //  Test for delay of start of new year and to avoid
+// //  Sunday, Wednesday, and Friday as start of the new year.
+
+// ti::real hebrew_delay_1(ti::real year)
+// {
+//     ti::real months, day, parts;
+
+//     months = (((year * 235) - 234) / 19).floor();
+//     parts = (months * 13753) + 12084;
+//     day = (months * 29) + (parts / 25920).floor();
+
+//     if (((day + 1) * 3).fmod(7) < 3)
+//     {
+//         day++;
+//     }
+//     return day;
+// }
+
+// //  Check for delay in start of new year due to length of adjacent years
+
+// ti::real hebrew_delay_2(ti::real year)
+// {
+//     ti::real last, present, next;
+
+//     last = hebrew_delay_1(year - 1);
+//     present = hebrew_delay_1(year);
+//     next = hebrew_delay_1(year + 1);
+
+//     return ((next - present) == 356) ? 2 : (((present - last) == 382) ? 1 : 0);
+// }
+
+// //  How many days are in a Hebrew year ?
+
+// ti::real hebrew_year_days(ti::real year)
+// {
+//     return hebrew_to_jd(year + 1, 7, 1) - hebrew_to_jd(year, 7, 1);
+// }
+
+// //  How many days are in a given month of a given year
+
+// ti::real hebrew_month_days(ti::real year, ti::real month)
+// {
+//     //  First of all, dispose of fixed-length 29 day months
+
+//     if (month == 2 || month == 4 || month == 6 ||
+//         month == 10 || month == 13)
+//     {
+//         return 29;
+//     }
+
+//     //  If it's not a leap year, Adar has 29 days
+
+//     if (month == 12 && !hebrew_leap(year))
+//     {
+//         return 29;
+//     }
+
+//     //  If it's Heshvan, days depend on length of year
+
+//     if (month == 8 && !(hebrew_year_days(year).fmod(10) == 5))
+//     {
+//         return 29;
+//     }
+
+//     //  Similarly, Kislev varies with the length of year
+
+//     if (month == 9 && (hebrew_year_days(year).fmod(10) == 3))
+//     {
+//         return 29;
+//     }
+
+//     //  Nope, it's a 30 day month
+
+//     return 30;
+// }
+
+//  Finally, wrap it all up into...
+
+// ti::real hebrew_to_jd(ti::real year, ti::real month, ti::real day)
+// {
+//     ti::real jd, mon, months;
+
+//     months = hebrew_year_months(year);
+//     jd = HEBREW_EPOCH + hebrew_delay_1(year) +
+//          hebrew_delay_2(year) + day + 1;
+
+//     if (month < 7)
+//     {
+//         for (mon = 7; mon <= months; mon++)
+//         {
+//             jd += hebrew_month_days(year, mon);
+//         }
+//         for (mon = 1; mon < month; mon++)
+//         {
+//             jd += hebrew_month_days(year, mon);
+//         }
+//     }
+//     else
+//     {
+//         for (mon = 7; mon < month; mon++)
+//         {
+//             jd += hebrew_month_days(year, mon);
+//         }
+//     }
+
+//     return jd;
+// }
+
+ti::real d3(ti::real a1)
+{
+    ti::real m2, w4, u2;
+
+    m2 = a1.fma(235_r, -234_r).floor_div(19_r);
+    w4 = m2.divmod(25920_r, &u2);
+    return m2.fma(29_r, w4 * 13753_r) + u2.fma(13753_r, 12084_r).floor_div(25920_r);
+}
+// d5 and d1 give the start of a year and are needed for the same few
+// neighbouring years many times per conversion, so the last results are
+// kept for the rest of the run (batch requests included). Years are
+// matched on their real_t bytes, which avoids any OS calls on a hit.
+
+#define HEBREW_CACHE_SIZE 8
+
+struct hebrew_cache
+{
+    real_t year[HEBREW_CACHE_SIZE];
+    ti::real value[HEBREW_CACHE_SIZE];
+    uint8_t count;
+    uint8_t next;
+};
+
+static hebrew_cache d5_cache, d1_cache;
+
+static bool hebrew_cache_find(const hebrew_cache *cache, const ti::real &year, ti::real *value)
+{
+    real_t key = year;
+    for (uint8_t i = 0; i < cache->count; i++)
+    {
+        if (memcmp(&cache->year[i], &key, sizeof key) == 0)
+        {
+            *value = cache->value[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+static ti::real hebrew_cache_add(hebrew_cache *cache, const ti::real &year, const ti::real &value)
+{
+    cache->year[cache->next] = year;
+    cache->value[cache->next] = value;
+    cache->next = (cache->next + 1) % HEBREW_CACHE_SIZE;
+    if (cache->count < HEBREW_CACHE_SIZE)
+    {
+        cache->count++;
+    }
+    return value;
+}
+
+ti::real d5(ti::real a1)
+{
+    ti::real d, weekday;
+    if (hebrew_cache_find(&d5_cache, a1, &d))
+    {
+        return d;
+    }
+    d = d3(a1);
+    d.divmod(7_r, &weekday);
+    return hebrew_cache_add(&d5_cache, a1, d + (weekday * 6_r).floor_div(7_r).fmod(2_r));
+}
+ti::real l2(ti::real a1)
+{
+    return d5(a1 + 1_r) - d5(a1);
+}
+ti::real d1(ti::real a1)
+{
+    ti::real d;
+    if (hebrew_cache_find(&d1_cache, a1, &d))
+    {
+        return d;
+    }
+    return hebrew_cache_add(&d1_cache, a1, d5(a1) + (l2(a1) + 19_r).floor_div(15_r).fmod(2_r) * 2_r + (l2(a1 - 1_r) + 7_r).floor_div(15_r).fmod(2_r));
+}
+ti::real d2(ti::real a1, ti::real m1)
+{
+    ti::real l = d1(a1 + 1_r) - d1(a1);
+    return d1(a1) + m1.fma(384_r, 10_r).floor_div(13_r) + ((l + 1_r).floor_div(2_r).fmod(3_r) * (m1 + 10_r).floor_div(12_r)) - ((385_r - l).floor_div(2_r).fmod(3_r) * (m1 + 9_r).floor_div(12_r));
+}
+
+ti::real hebrew_to_jd(ti::real year, ti::real month, ti::real day)
+{
+    ti::real m1, a1;
+
+    m1 = month - 7_r;
+    a1 = year - m1.floor_div(10_r);
+    return d2(a1, m1) +
+           day + 347996.5_r;
+}
+
+void jd_to_hebrew(ti::real jd, real_t result[3])
+{
+    ti::real s, w1, e1, u3, a3, e3, u4, d14, u5, a4, e4, u6, d15, u7, a1, e5, m1, d0, year, month, day;
+
+    s = (jd - 0.5_r).floor() - 347997_r;
+    w1 = s.divmod(33783_r, &e1);
+    u3 = w1.fma(1144_r, (w1.fma(8_r, e1 * 25920_r) + 13835_r).floor_div(765433_r)) + 1_r;
+    a3 = u3.fma(19_r, 366_r).divmod(235_r, &e3);
+    u4 = e3.floor_div(19_r) - 6_r;
+    d14 = s - d2(a3, u4);
+    u5 = u3 + d14.floor_div(64_r);
+    a4 = u5.fma(19_r, 366_r).divmod(235_r, &e4);
+    u6 = e4.floor_div(19_r) - 6_r;
+    d15 = s - d2(a4, u6);
+    u7 = u5 + d15.floor_div(64_r);
+    a1 = u7.fma(19_r, 366_r).divmod(235_r, &e5);
+    m1 = e5.floor_div(19_r) - 6_r;
+    d0 = s - d2(a1, m1);
+    year = a1 + m1.floor_div(10_r);
+    month = m1 + 7_r;
+    day = d0 + 1_r;
+
+    result[0] = year;
+    result[1] = month;
+    result[2] = day;
+}
+
+// /*  JD_TO_HEBREW  --  Convert Julian date to Hebrew date
+//                       This works by making multiple calls to
+//                       the inverse function, and is this very
+//                       slow.  */
+
+// void jd_to_hebrew(ti::real jd, real_t result[3])
+// {
+//     ti::real year, month, day, i, count, first;
+
+//     jd = jd.floor() + 0.5;
+//     count = (((jd - HEBREW_EPOCH) * 98496) / 35975351).floor();
+//     year = count - 1;
+//     for (i = count; jd >= hebrew_to_jd(i, 7, 1); i++)
+//     {
+//         year++;
+//     }
+//     first = (jd < hebrew_to_jd(year, 1, 1)) ? 7 : 1;
+//     month = first;
+//     for (i = first; jd > hebrew_to_jd(year, i, hebrew_month_days(year, i)); i++)
+//     {
+//         month++;
+//     }
+//     day = (jd - hebrew_to_jd(year, month, 1)) + 1;
+
+//     result[0] = year;
+//     result[1] = month;
+//     result[2] = day;
+// }
+
+// Islamic
+
+bool leap_islamic(ti::real year)
+{
+    return (((year * 11_r) + 14_r) % 30_r) < 11_r;
+}
+
+#define ISLAMIC_EPOCH 1948439.5_r
+
+static constexpr ti::real ISLAMIC_EPOCH_MINUS_1 = ti::real::fold_sub(ISLAMIC_EPOCH, 1_r);
+
+ti::real islamic_to_jd(ti::real year, ti::real month, ti::real day)
+{
+    return day +
+           ((month - 1_r) * 29.5_r).ceil() +
+           (year - 1_r) * 354_r +
+           year.fma(11_r, 3_r).floor_div(30_r) +
+           ISLAMIC_EPOCH_MINUS_1;
+}
+
+void jd_to_islamic(ti::real jd, real_t result[3])
+{
+    ti::real year, month, day;
+
+    jd = day_start(jd);
+    year = (jd - ISLAMIC_EPOCH).fma(30_r, 10646_r).floor_div(10631_r);
+    month = (((jd - (islamic_to_jd(year, 1_r, 1_r) + 29_r)) / 29.5_r).ceil() + 1_r).fmin(12_r);
+    day = (jd - islamic_to_jd(year, month, 1_r)) + 1_r;
+
+    result[0] = year;
+    result[1] = month;
+    result[2] = day;
+}
+
+//  Persian
+
+#define PERSIAN_EPOCH 1948320.5_r
+
+static constexpr ti::real PERSIAN_EPOCH_MINUS_1 = ti::real::fold_sub(PERSIAN_EPOCH, 1_r);
+
+// persian_to_jd(475, 1, 1): epbase = 1 and epyear = 475, so it is
+// 1 + floor((475 * 682 - 110) / 2816) + 474 * 365 + PERSIAN_EPOCH - 1
+// = PERSIAN_EPOCH + 1 + 115 + 173010 - 1
+static constexpr ti::real PERSIAN_475_EPOCH = ti::real::fold_add(PERSIAN_EPOCH, 173125_r);
+
+bool leap_persian(ti::real year)
+{
+    return ((((((year - ((year > 0_r) ? 474_r : 473_r)) % 2820_r) + 474_r) + 38_r) * 682_r) % 2816_r) < 682_r;
+}
+
+ti::real persian_to_jd(ti::real year, ti::real month, ti::real day)
+{
+    ti::real epbase, epyear, cycle;
+
+    epbase = year - ((year >= 0_r) ? 474_r : 473_r);
+    cycle = epbase.divmod(2820_r, &epyear);
+    epyear += 474_r;
+
+    return day +
+           ((month <= 7_r) ? ((month - 1_r) * 31_r) : (((month - 1_r) * 30_r) + 6_r)) +
+           epyear.fma(682_r, -110_r).floor_div(2816_r) +
+           (epyear - 1_r) * 365_r +
+           cycle * 1029983_r +
+           PERSIAN_EPOCH_MINUS_1;
+}
+
+void jd_to_persian(ti::real jd, real_t result[3])
+{
+    ti::real year, month, day, depoch, cycle, cyear, ycycle,
+        aux1, aux2, yday;
+
+    jd = day_start(jd);
+
+    depoch = jd - PERSIAN_475_EPOCH;
+    cycle = depoch.divmod(1029983_r, &cyear);
+    if (cyear == 1029982_r)
+    {
+        ycycle = 2820_r;
+    }
+    else
+    {
+        aux1 = cyear.divmod(366_r, &aux2);
+        ycycle = (aux1.fma(2134_r, aux2 * 2816_r) + 2815_r).floor_div(1028522_r) +
+                 aux1 + 1_r;
+    }
+    year = ycycle + (cycle * 2820_r) + 474_r;
+    if (year <= 0_r)
+    {
+        year--;
+    }
+    yday = (jd - persian_to_jd(year, 1_r, 1_r)) + 1_r;
+    month = (yday <= 186_r) ? (yday / 31_r).ceil() : ((yday - 6_r) / 30_r).ceil();
+    day = (jd - persian_to_jd(year, month, 1_r)) + 1_r;
+
+    result[0] = year;
+    result[1] = month;
+    result[2] = day;
+}
+
+// Mayan
+
+#define MAYAN_COUNT_EPOCH 584282.5_r
+
+ti::real mayan_count_to_jd(ti::real baktun, ti::real katun, ti::real tun, ti::real uinal, ti::real kin)
+{
+    return MAYAN_COUNT_EPOCH +
+           (baktun * 144000_r) +
+           (katun * 7200_r) +
+           (tun * 360_r) +
+           (uinal * 20_r) +
+           kin;
+}
+
+void jd_to_mayan_count(ti::real jd, real_t result[5])
+{
+    ti::real d, baktun, katun, tun, uinal, kin;
+
+    jd = day_start(jd);
+    d = jd - MAYAN_COUNT_EPOCH;
+    baktun = d.divmod(144000_r, &d);
+    katun = d.divmod(7200_r, &d);
+    tun = d.divmod(360_r, &d);
+    uinal = d.divmod(20_r, &kin);
+
+    result[0] = baktun;
+    result[1] = katun;
+    result[2] = tun;
+    result[3] = uinal;
+    result[4] = kin;
+}
+
+void jd_to_mayan_haab(ti::real jd, real_t result[2])
+{
+    ti::real lcount, day, month;
+
+    jd = day_start(jd);
+    lcount = jd - MAYAN_COUNT_EPOCH;
+    (lcount + 348_r).divmod(365_r, &day);
+    month = day.divmod(20_r, &day);
+
+    result[0] = month + 1_r;
+    result[1] = day;
+}
+
+void jd_to_mayan_tzolkin(ti::real jd, real_t result[2])
+{
+    ti::real lcount, day, number;
+
+    jd = day_start(jd);
+    lcount = jd - MAYAN_COUNT_EPOCH;
+    (lcount + 19_r).divmod(20_r, &day);
+    (lcount + 3_r).divmod(13_r, &number);
+    result[0] = day + 1_r;
+    result[1] = number + 1_r;
+}
+
+// Indian Civil Calendar
+
+ti::real indian_civil_to_jd(ti::real year, ti::real month, ti::real day)
+{
+    ti::real Caitra, gyear, leap, start, jd, m;
+
+    gyear = year + 78_r;
+    leap = leap_gregorian(gyear);
+    start = gregorian_to_jd(gyear, 3_r, leap ? 21_r : 22_r);
+    Caitra = leap ? 31_r : 30_r;
+
+    if (month == 1_r)
+    {
+        jd = start + (day - 1_r);
+    }
+    else
+    {
+        jd = start + Caitra;
+        m = month - 2_r;
+        m = m.fmin(5_r);
+        jd += m * 31_r;
+        if (month >= 8_r)
+        {
+            m = month - 7_r;
+            jd += m * 30_r;
+        }
+        jd += day - 1_r;
+    }
+
+    return jd;
+}
+
+//  JD_TO_INDIAN_CIVIL  --  Calculate Indian Civil date from Julian day
+
+// The Indian Civil date is worked out from the Gregorian one, which
+// jd_to_all already has
+
+static void indian_civil_from_gregorian(ti::real jd, const real_t greg[3], real_t result[3])
+{
+    ti::real Caitra, Saka, greg0, leap, start, year, yday, mday, month, day;
+
+    Saka = 78_r;  // Offset in years from Saka era to Gregorian epoch
+    start = 80_r; // Day offset between Saka
+
+    leap = leap_gregorian(greg[0]);             // Is this a leap year?
+    year = ti::real(greg[0]) - Saka;            // Tentative year in Saka era
+    greg0 = gregorian_to_jd(greg[0], 1_r, 1_r); // JD at start of Gregorian year
+    yday = jd - greg0;                          // Day number (0 based) in Gregorian year
+    Caitra = leap ? 31_r : 30_r;                // Days in Caitra this year
+
+    if (yday < start)
+    {
+        //  Day is at the end of the preceding Saka year
+        year--;
+        yday += Caitra + 255_r + start; // 31 * 5 + 30 * 3 + 10
+    }
+
+    yday -= start;
+    if (yday < Caitra)
+    {
+        month = 1_r;
+        day = yday + 1_r;
+    }
+    else
+    {
+        mday = yday - Caitra;
+        if (mday < 155_r)
+        {
+            month = (mday / 31_r).floor() + 2_r;
+            day = (mday % 31_r) + 1_r;
+        }
+        else
+        {
+            mday -= 155_r;
+            month = (mday / 30_r).floor() + 7_r;
+            day = (mday % 30_r) + 1_r;
+        }
+    }
+
+    result[0] = year;
+    result[1] = month;
+    result[2] = day;
+}
+
+void jd_to_indian_civil(ti::real jd, real_t result[3])
+{
+    real_t greg[3];
+
+    jd = day_start(jd);
+    jd_to_gregorian(jd, greg); // Gregorian date for Julian day
+    indian_civil_from_gregorian(jd, greg, result);
+}
+
+void jd_to_all(ti::real jd, real_t result[ALL_CALENDARS][ALL_CALENDARS_WIDTH])
+{
+    // The Indian Civil date is worked out from the Gregorian one
+    jd = day_start(jd);
+    jd_to_gregorian(jd, result[0]);
+    jd_to_julian(jd, result[1]);
+    jd_to_hebrew(jd, result[2]);
+    jd_to_islamic(jd, result[3]);
+    jd_to_persian(jd, result[4]);
+    jd_to_mayan_count(jd, result[5]);
+    jd_to_mayan_haab(jd, result[5] + 5);
+    jd_to_mayan_tzolkin(jd, result[5] + 7);
+    indian_civil_from_gregorian(jd, result[0], result[6]);
+    jd_to_chinese(jd, result[7]);
+}
+
+#else
+
+// Integer engine: ti::real is only used to cross the matrix J boundary.
+// Dates and JDs outside the range in calendar_int.h convert to 0, like the
+// Chinese calendar outside its table.
+
+static void store_zero(real_t *result, uint8_t count)
+{
+    for (uint8_t i = 0; i < count; i++)
+    {
+        result[i] = bcd_pack(0, 0);
+    }
+}
+
+#define TO_JD_ADAPTER(name)                                             \
+    ti::real name##_to_jd(ti::real year, ti::real month, ti::real day) \
+    {                                                                   \
+        int32_t y = to_int(year), m = to_int(month), d = to_int(day);   \
+        if (!date_in_range(y, m, d))                                    \
+        {                                                               \
+            return 0_r;                                                 \
+        }                                                               \
+        return from_jdn(name##_to_jdn(y, m, d));                        \
+    }
+
+#define FROM_JD_ADAPTER(name, count)                    \
+    void jd_to_##name(ti::real jd, real_t result[count]) \
+    {                                                   \
+        int32_t jdn = to_jdn(jd), values[count];        \
+        if (!in_limit(jdn, JDN_LIMIT))                  \
+        {                                               \
+            store_zero(result, count);                  \
+            return;                                     \
+        }                                               \
+        jdn_to_##name(jdn, values);                     \
+        store(result, values, count);                   \
+    }
+
+TO_JD_ADAPTER(gregorian)
+FROM_JD_ADAPTER(gregorian, 3)
+TO_JD_ADAPTER(julian)
+FROM_JD_ADAPTER(julian, 3)
+TO_JD_ADAPTER(hebrew)
+FROM_JD_ADAPTER(hebrew, 3)
+TO_JD_ADAPTER(islamic)
+FROM_JD_ADAPTER(islamic, 3)
+TO_JD_ADAPTER(persian)
+FROM_JD_ADAPTER(persian, 3)
+FROM_JD_ADAPTER(mayan_count, 5)
+FROM_JD_ADAPTER(mayan_haab, 2)
+FROM_JD_ADAPTER(mayan_tzolkin, 2)
+TO_JD_ADAPTER(indian_civil)
+FROM_JD_ADAPTER(indian_civil, 3)
+
+#undef TO_JD_ADAPTER
+#undef FROM_JD_ADAPTER
+
+ti::real mayan_count_to_jd(ti::real baktun, ti::real katun, ti::real tun, ti::real uinal, ti::real kin)
+{
+    int32_t count[5] = {to_int(baktun), to_int(katun), to_int(tun), to_int(uinal), to_int(kin)};
+    if (!mayan_count_in_range(count[0], count[1], count[2], count[3], count[4]))
+    {
+        return 0_r;
+    }
+    return from_jdn(mayan_count_to_jdn(count[0], count[1], count[2], count[3], count[4]));
+}
+
+void jd_to_all(ti::real jd, real_t result[ALL_CALENDARS][ALL_CALENDARS_WIDTH])
+{
+    int32_t jdn = to_jdn(jd);
+    int32_t values[ALL_CALENDARS_WIDTH];
+
+    if (!in_limit(jdn, JDN_LIMIT))
+    {
+        for (uint8_t i = 0; i < ALL_CALENDARS; i++)
+        {
+            store_zero(result[i], all_calendar_widths[i]);
+        }
+        return;
+    }
+
+    // The Indian Civil date reuses the Gregorian year
+    jdn_to_gregorian(jdn, values);
+    store(result[0], values, 3);
+    int32_t gregorian_year = values[0];
+    jdn_to_julian(jdn, values);
+    store(result[1], values, 3);
+    jdn_to_hebrew(jdn, values);
+    store(result[2], values, 3);
+    jdn_to_islamic(jdn, values);
+    store(result[3], values, 3);
+    jdn_to_persian(jdn, values);
+    store(result[4], values, 3);
+    jdn_to_mayan_count(jdn, values);
+    jdn_to_mayan_haab(jdn, values + 5);
+    jdn_to_mayan_tzolkin(jdn, values + 7);
+    store(result[5], values, 9);
+    jdn_to_indian_civil_from_gregorian(jdn, gregorian_year, values);
+    store(result[6], values, 3);
+    jdn_to_chinese(jdn, values);
+    store(result[7], values, 4);
+}
+
+#endif
+
+// Chinese: table lookups on day numbers in either engine
+
+ti::real chinese_to_jd(ti::real year, ti::real month, ti::real leap, ti::real day)
+{
+    int32_t jdn = chinese_to_jdn(to_int(year), to_int(month), leap != 0_r, to_int(day));
+    return (jdn == 0) ? 0_r : from_jdn(jdn);
+}
+
+void jd_to_chinese(ti::real jd, real_t result[4])
+{
+    int32_t values[4];
+    jdn_to_chinese(to_jdn(jd), values);
+    store(result, values, 4);
+}
@@ -0,0 +1,61 @@
+/*
+ *--------------------------------------
+ * Program Name: CALCONV
+ * Author: Tomi Chen
+ * License: MIT
+ * Description: Calendar conversions to and from Julian Days.
+ *
+ * Dates and Julian Days are passed as ti::real, whichever engine is
+ * selected with CALCONV_ENGINE_*. Nothing here depends on the calculator
+ * beyond <ti/real>, so the same file builds on a host for benchmarking.
+ *--------------------------------------
+ */
+
+#ifndef CALENDAR_H
+#define CALENDAR_H
+
+#include <ti/real>
+
+ti::real gregorian_to_jd(ti::real year, ti::real month, ti::real day);
+void jd_to_gregorian(ti::real jd, real_t result[3]);
+
+ti::real julian_to_jd(ti::real year, ti::real month, ti::real day);
+void jd_to_julian(ti::real jd, real_t result[3]);
+
+ti::real hebrew_to_jd(ti::real year, ti::real month, ti::real day);
+void jd_to_hebrew(ti::real jd, real_t result[3]);
+
+ti::real islamic_to_jd(ti::real year, ti::real month, ti::real day);
+void jd_to_islamic(ti::real jd, real_t result[3]);
+
+ti::real persian_to_jd(ti::real year, ti::real month, ti::real day);
+void jd_to_persian(ti::real jd, real_t result[3]);
+
+ti::real mayan_count_to_jd(ti::real baktun, ti::real katun, ti::real tun, ti::real uinal, ti::real kin);
+void jd_to_mayan_count(ti::real jd, real_t result[5]);
+void jd_to_mayan_haab(ti::real jd, real_t result[2]);
+void jd_to_mayan_tzolkin(ti::real jd, real_t result[2]);
+
+ti::real indian_civil_to_jd(ti::real year, ti::real month, ti::real day);
+void jd_to_indian_civil(ti::real jd, real_t result[3]);
+
+// Chinese dates are year, month, leap month flag (0 or 1) and day; both
+// directions give 0 outside the years in the Chinese table
+
+ti::real chinese_to_jd(ti::real year, ti::real month, ti::real leap, ti::real day);
+void jd_to_chinese(ti::real jd, real_t result[4]);
+
+// Every calendar at once, sharing the work they have in common. Row i is
+// the result of the JD -> calendar selection 2i + 1: Gregorian, Julian,
+// Hebrew, Islamic, Persian, Mayan (long count, Haab, Tzolkin), Indian
+// Civil and Chinese
+
+#define ALL_CALENDARS 8
+#define ALL_CALENDARS_WIDTH 9
+
+void jd_to_all(ti::real jd, real_t result[ALL_CALENDARS][ALL_CALENDARS_WIDTH]);
+
+// Columns used in each row of jd_to_all's result
+extern const uint8_t all_calendar_widths[ALL_CALENDARS];
+
+#endif
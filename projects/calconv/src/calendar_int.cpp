@@ -0,0 +1,703 @@
+/*
+ *--------------------------------------
+ * Program Name: CALCONV
+ * Author: Tomi Chen
+ * License: MIT
+ * Description: Integer calendar conversion kernel.
+ *
+ * Calendar conversion functions adapted from Fourmilab's calendar converter
+ *--------------------------------------
+ */
+
+#include <stddef.h>
+
+#include "calendar_int.h"
+
+#ifndef CALCONV_NO_YEAR_TABLES
+#include "year_table.h"
+#endif
+
+// Gregorian
+
+#define GREGORIAN_EPOCH_JDN 1721426
+
+bool leap_gregorian_int(int32_t year)
+{
+    return (floor_mod(year, 4) == 0 && (floor_mod(year, 100) != 0 || floor_mod(year, 400) == 0));
+}
+
+int32_t gregorian_to_jdn(int32_t year, int32_t month, int32_t day)
+{
+    return (GREGORIAN_EPOCH_JDN - 1) +
+           ((year - 1) * 365) +
+           floor_div(year - 1, 4) +
+           -floor_div(year - 1, 100) +
+           floor_div(year - 1, 400) +
+           floor_div((month * 367) - 362, 12) +
+           ((month <= 2) ? 0 : (leap_gregorian_int(year) ? -1 : -2)) +
+           day;
+}
+
+void jdn_to_gregorian(int32_t jdn, int32_t result[3])
+{
+    int32_t depoch, quadricent, dqc, cent, dcent, quad, dquad,
+        yindex, year, yearday, leapadj, month, day;
+
+    depoch = jdn - GREGORIAN_EPOCH_JDN;
+    quadricent = floor_divmod(depoch, 146097, &dqc);
+    cent = floor_divmod(dqc, 36524, &dcent);
+    quad = floor_divmod(dcent, 1461, &dquad);
+    yindex = dquad / 365;
+    year = (quadricent * 400) + (cent * 100) + (quad * 4) + yindex;
+    if (!((cent == 4) || (yindex == 4)))
+    {
+        year++;
+    }
+    yearday = jdn - gregorian_to_jdn(year, 1, 1);
+    leapadj = ((jdn < gregorian_to_jdn(year, 3, 1)) ? 0
+                                                    : (leap_gregorian_int(year) ? 1 : 2));
+    month = (((yearday + leapadj) * 12) + 373) / 367;
+    day = (jdn - gregorian_to_jdn(year, month, 1)) + 1;
+
+    result[0] = year;
+    result[1] = month;
+    result[2] = day;
+}
+
+// Julian
+
+bool leap_julian_int(int32_t year)
+{
+    return floor_mod(year, 4) == ((year > 0) ? 0 : 3);
+}
+
+int32_t julian_to_jdn(int32_t year, int32_t month, int32_t day)
+{
+
+    /* Adjust negative common era years to the zero-based notation we use.  */
+
+    if (year < 1)
+    {
+        year++;
+    }
+
+    /* Algorithm as given in Meeus, Astronomical Algorithms, Chapter 7, page 61.
+       365.25 and 30.6001 are scaled to integer fractions.  */
+
+    if (month <= 2)
+    {
+        year--;
+        month += 12;
+    }
+
+    return floor_div((year + 4716) * 1461, 4) +
+           floor_div((month + 1) * 306001, 10000) +
+           day - 1524;
+}
+
+void jdn_to_julian(int32_t jdn, int32_t result[3])
+{
+    int32_t b, c, d, e, year, month, day, cycle, rest;
+
+    /* c = floor((b - 122.1) / 365.25), taken one four-year cycle of 1461
+       days at a time so b * 100 can't overflow.  */
+
+    b = jdn + 1524;
+    cycle = floor_divmod(b, 1461, &rest);
+    c = (cycle * 4) + floor_div((rest * 100) - 12210, 36525);
+    d = floor_div(c * 1461, 4);
+    e = ((b - d) * 10000) / 306001;
+
+    month = (e < 14) ? (e - 1) : (e - 13);
+    year = (month > 2) ? (c - 4716) : (c - 4715);
+    day = b - d - ((e * 306001) / 10000);
+
+    /*  If year is less than 1, subtract one to convert from
+        a zero based date system to the common era system in
+        which the year -1 (1 B.C.E) is followed by year 1 (1 C.E.).  */
+
+    if (year < 1)
+    {
+        year--;
+    }
+
+    result[0] = year;
+    result[1] = month;
+    result[2] = day;
+}
+
+// Hebrew
+
+static int32_t d3(int32_t a1)
+{
+    int32_t m2, w4, u2;
+
+    m2 = floor_div((a1 * 235) - 234, 19);
+    w4 = floor_divmod(m2, 25920, &u2);
+    return (m2 * 29) + (w4 * 13753) + (((u2 * 13753) + 12084) / 25920);
+}
+// d5 and d1 give the start of a year and are needed for the same few
+// neighbouring years many times per conversion, so the last results are
+// kept for the rest of the run (batch requests included)
+
+#define HEBREW_CACHE_SIZE 8
+
+struct hebrew_cache
+{
+    int32_t year[HEBREW_CACHE_SIZE];
+    int32_t value[HEBREW_CACHE_SIZE];
+    uint8_t count;
+    uint8_t next;
+};
+
+static hebrew_cache d5_cache, d1_cache;
+
+static bool hebrew_cache_find(const hebrew_cache *cache, int32_t year, int32_t *value)
+{
+    for (uint8_t i = 0; i < cache->count; i++)
+    {
+        if (cache->year[i] == year)
+        {
+            *value = cache->value[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+static int32_t hebrew_cache_add(hebrew_cache *cache, int32_t year, int32_t value)
+{
+    cache->year[cache->next] = year;
+    cache->value[cache->next] = value;
+    cache->next = (cache->next + 1) % HEBREW_CACHE_SIZE;
+    if (cache->count < HEBREW_CACHE_SIZE)
+    {
+        cache->count++;
+    }
+    return value;
+}
+
+static int32_t d5(int32_t a1)
+{
+    int32_t d;
+    if (hebrew_cache_find(&d5_cache, a1, &d))
+    {
+        return d;
+    }
+    d = d3(a1);
+    return hebrew_cache_add(&d5_cache, a1, d + ((floor_mod(d, 7) * 6 / 7) % 2));
+}
+static int32_t l2(int32_t a1)
+{
+    return d5(a1 + 1) - d5(a1);
+}
+static int32_t d1(int32_t a1)
+{
+    int32_t d;
+    if (hebrew_cache_find(&d1_cache, a1, &d))
+    {
+        return d;
+    }
+    return hebrew_cache_add(&d1_cache, a1, d5(a1) + (((l2(a1) + 19) / 15) % 2) * 2 + (((l2(a1 - 1) + 7) / 15) % 2));
+}
+static int32_t d2(int32_t a1, int32_t m1)
+{
+    int32_t start = d1(a1);
+    int32_t l = d1(a1 + 1) - start;
+    return start + floor_div((m1 * 384) + 10, 13) + ((((l + 1) / 2) % 3) * floor_div(m1 + 10, 12)) - ((((385 - l) / 2) % 3) * floor_div(m1 + 9, 12));
+}
+
+int32_t hebrew_to_jdn(int32_t year, int32_t month, int32_t day)
+{
+    int32_t m1, a1;
+
+    m1 = month - 7;
+    a1 = year - floor_div(m1, 10);
+    return d2(a1, m1) + day + 347997;
+}
+
+// Days in a month of a year with the given length. Heshvan (8) and Kislev
+// (9) depend on the length, and leap years have a 30 day Adar I (12) before
+// Adar II (13) instead of a 29 day Adar (12).
+
+static int32_t hebrew_month_length(int32_t length, int32_t month)
+{
+    bool leap = length > 355;
+    switch (month)
+    {
+    case 8:
+        return (length % 10 == 5) ? 30 : 29;
+    case 9:
+        return (length % 10 == 3) ? 29 : 30;
+    case 12:
+        return leap ? 30 : 29;
+    case 13:
+        return leap ? 29 : 0;
+    default:
+        return (month % 2 == 1) ? 30 : 29;
+    }
+}
+
+#ifndef CALCONV_NO_YEAR_TABLES
+
+// Month and day from the day of the year (0 = 1 Tishri) and the year length
+
+static void hebrew_date_in_year(int32_t year, int32_t yday, int32_t length, int32_t result[3])
+{
+    static const uint8_t months[] = {7, 8, 9, 10, 11, 12, 13, 1, 2, 3, 4, 5, 6};
+
+    uint8_t i = 0;
+    while (yday >= hebrew_month_length(length, months[i]))
+    {
+        yday -= hebrew_month_length(length, months[i++]);
+    }
+
+    result[0] = year;
+    result[1] = months[i];
+    result[2] = yday + 1;
+}
+
+#endif
+
+void jdn_to_hebrew(int32_t jdn, int32_t result[3])
+{
+#ifndef CALCONV_NO_YEAR_TABLES
+    int32_t year, start, length;
+    if (year_table_find(&hebrew_year_table, jdn, &year, &start, &length))
+    {
+        hebrew_date_in_year(year, jdn - start, length, result);
+        return;
+    }
+#endif
+
+    int32_t s, w1, e1, u3, a3, e3, u4, d14, u5, a4, e4, u6, d15, u7, a1, e5, m1, d0;
+
+    s = jdn - 347998;
+    w1 = floor_divmod(s, 33783, &e1);
+    u3 = (w1 * 1144) + floor_div((w1 * 8) + (e1 * 25920) + 13835, 765433) + 1;
+    a3 = floor_divmod((u3 * 19) + 366, 235, &e3);
+    u4 = (e3 / 19) - 6;
+    d14 = s - d2(a3, u4);
+    u5 = u3 + floor_div(d14, 64);
+    a4 = floor_divmod((u5 * 19) + 366, 235, &e4);
+    u6 = (e4 / 19) - 6;
+    d15 = s - d2(a4, u6);
+    u7 = u5 + floor_div(d15, 64);
+    a1 = floor_divmod((u7 * 19) + 366, 235, &e5);
+    m1 = (e5 / 19) - 6;
+    d0 = s - d2(a1, m1);
+
+    result[0] = a1 + floor_div(m1, 10);
+    result[1] = m1 + 7;
+    result[2] = d0 + 1;
+}
+
+// Islamic
+
+#define ISLAMIC_EPOCH_JDN 1948440
+
+bool leap_islamic_int(int32_t year)
+{
+    return floor_mod((year * 11) + 14, 30) < 11;
+}
+
+int32_t islamic_to_jdn(int32_t year, int32_t month, int32_t day)
+{
+    return day +
+           ceil_div((month - 1) * 59, 2) +
+           (year - 1) * 354 +
+           floor_div((year * 11) + 3, 30) + ISLAMIC_EPOCH_JDN -
+           1;
+}
+
+void jdn_to_islamic(int32_t jdn, int32_t result[3])
+{
+    int32_t year, start, month, day;
+
+#ifndef CALCONV_NO_YEAR_TABLES
+    int32_t length;
+    if (!year_table_find(&islamic_year_table, jdn, &year, &start, &length))
+#endif
+    {
+        // floor((30 * days + 10646) / 10631), a 30-year cycle of 10631
+        // days at a time so the product can't overflow
+        int32_t days, cycle = floor_divmod(jdn - ISLAMIC_EPOCH_JDN, 10631, &days);
+        year = (cycle * 30) + floor_div((days * 30) + 10646, 10631);
+        start = islamic_to_jdn(year, 1, 1);
+    }
+    month = ceil_div((jdn - (start + 29)) * 2, 59) + 1;
+    if (month > 12)
+    {
+        month = 12;
+    }
+    day = (jdn - (start + ceil_div((month - 1) * 59, 2))) + 1;
+
+    result[0] = year;
+    result[1] = month;
+    result[2] = day;
+}
+
+//  Persian
+
+#define PERSIAN_EPOCH_JDN 1948321
+
+bool leap_persian_int(int32_t year)
+{
+    return (((floor_mod(year - ((year > 0) ? 474 : 473), 2820) + 474 + 38) * 682) % 2816) < 682;
+}
+
+int32_t persian_to_jdn(int32_t year, int32_t month, int32_t day)
+{
+    int32_t epbase, epyear, cycle;
+
+    epbase = year - ((year >= 0) ? 474 : 473);
+    cycle = floor_divmod(epbase, 2820, &epyear);
+    epyear += 474;
+
+    return day +
+           ((month <= 7) ? ((month - 1) * 31) : (((month - 1) * 30) + 6)) +
+           (((epyear * 682) - 110) / 2816) +
+           (epyear - 1) * 365 +
+           cycle * 1029983 +
+           (PERSIAN_EPOCH_JDN - 1);
+}
+
+void jdn_to_persian(int32_t jdn, int32_t result[3])
+{
+    int32_t year, start, month, day, depoch, cycle, cyear, ycycle,
+        aux1, aux2, yday;
+
+#ifndef CALCONV_NO_YEAR_TABLES
+    int32_t length;
+    if (!year_table_find(&persian_year_table, jdn, &year, &start, &length))
+#endif
+    {
+        depoch = jdn - persian_to_jdn(475, 1, 1);
+        cycle = floor_divmod(depoch, 1029983, &cyear);
+        if (cyear == 1029982)
+        {
+            ycycle = 2820;
+        }
+        else
+        {
+            aux1 = floor_divmod(cyear, 366, &aux2);
+            ycycle = (((aux1 * 2134) + (aux2 * 2816) + 2815) / 1028522) +
+                     aux1 + 1;
+        }
+        year = ycycle + (cycle * 2820) + 474;
+        if (year <= 0)
+        {
+            year--;
+        }
+        start = persian_to_jdn(year, 1, 1);
+    }
+    yday = (jdn - start) + 1;
+    month = (yday <= 186) ? ceil_div(yday, 31) : ceil_div(yday - 6, 30);
+    day = yday - ((month <= 7) ? ((month - 1) * 31) : (((month - 1) * 30) + 6));
+
+    result[0] = year;
+    result[1] = month;
+    result[2] = day;
+}
+
+// Mayan
+
+#define MAYAN_COUNT_EPOCH_JDN 584283
+
+int32_t mayan_count_to_jdn(int32_t baktun, int32_t katun, int32_t tun, int32_t uinal, int32_t kin)
+{
+    return MAYAN_COUNT_EPOCH_JDN +
+           (baktun * 144000) +
+           (katun * 7200) +
+           (tun * 360) +
+           (uinal * 20) +
+           kin;
+}
+
+void jdn_to_mayan_count(int32_t jdn, int32_t result[5])
+{
+    int32_t d;
+
+    d = jdn - MAYAN_COUNT_EPOCH_JDN;
+    result[0] = floor_divmod(d, 144000, &d);
+    result[1] = floor_divmod(d, 7200, &d);
+    result[2] = floor_divmod(d, 360, &d);
+    result[3] = floor_divmod(d, 20, &result[4]);
+}
+
+void jdn_to_mayan_haab(int32_t jdn, int32_t result[2])
+{
+    int32_t day;
+
+    day = floor_mod(jdn - MAYAN_COUNT_EPOCH_JDN + 8 + ((18 - 1) * 20), 365);
+
+    result[0] = floor_divmod(day, 20, &result[1]) + 1;
+}
+
+void jdn_to_mayan_tzolkin(int32_t jdn, int32_t result[2])
+{
+    int32_t lcount;
+
+    lcount = jdn - MAYAN_COUNT_EPOCH_JDN;
+    result[0] = floor_mod(lcount + 20 - 1, 20) + 1;
+    result[1] = floor_mod(lcount + 4 - 1, 13) + 1;
+}
+
+// Indian Civil Calendar
+
+int32_t indian_civil_to_jdn(int32_t year, int32_t month, int32_t day)
+{
+    int32_t Caitra, gyear, start, jdn, m;
+    bool leap;
+
+    gyear = year + 78;
+    leap = leap_gregorian_int(gyear);
+    start = gregorian_to_jdn(gyear, 3, leap ? 21 : 22);
+    Caitra = leap ? 31 : 30;
+
+    if (month == 1)
+    {
+        jdn = start + (day - 1);
+    }
+    else
+    {
+        jdn = start + Caitra;
+        m = month - 2;
+        m = (m < 5) ? m : 5;
+        jdn += m * 31;
+        if (month >= 8)
+        {
+            m = month - 7;
+            jdn += m * 30;
+        }
+        jdn += day - 1;
+    }
+
+    return jdn;
+}
+
+//  JDN_TO_INDIAN_CIVIL  --  Calculate Indian Civil date from Julian day number
+
+// gregorian_year is the Gregorian year of jdn if the caller already has it,
+// or NULL to work it out here when the year table doesn't cover jdn
+
+static void indian_civil(int32_t jdn, const int32_t *gregorian_year, int32_t result[3])
+{
+    int32_t Caitra, year, yday, mday, month, day;
+
+#ifndef CALCONV_NO_YEAR_TABLES
+    int32_t year_start, length;
+    if (year_table_find(&indian_civil_year_table, jdn, &year, &year_start, &length))
+    {
+        yday = jdn - year_start;
+        Caitra = length - (31 * 5) - (30 * 6); // Caitra takes the leap day
+    }
+    else
+#endif
+    {
+        int32_t Saka, gyear, greg0, start;
+        bool leap;
+
+        Saka = 79 - 1; // Offset in years from Saka era to Gregorian epoch
+        start = 80;    // Day offset between Saka
+
+        if (gregorian_year)
+        {
+            gyear = *gregorian_year;
+        }
+        else
+        {
+            int32_t greg[3];
+            jdn_to_gregorian(jdn, greg); // Gregorian date for Julian day
+            gyear = greg[0];
+        }
+
+        leap = leap_gregorian_int(gyear);      // Is this a leap year?
+        year = gyear - Saka;                   // Tentative year in Saka era
+        greg0 = gregorian_to_jdn(gyear, 1, 1); // JDN at start of Gregorian year
+        yday = jdn - greg0;                    // Day number (0 based) in Gregorian year
+        Caitra = leap ? 31 : 30;               // Days in Caitra this year
+
+        if (yday < start)
+        {
+            //  Day is at the end of the preceding Saka year
+            year--;
+            yday += Caitra + (31 * 5) + (30 * 3) + 10 + start;
+        }
+
+        yday -= start;
+    }
+
+    if (yday < Caitra)
+    {
+        month = 1;
+        day = yday + 1;
+    }
+    else
+    {
+        mday = yday - Caitra;
+        if (mday < (31 * 5))
+        {
+            month = (mday / 31) + 2;
+            day = (mday % 31) + 1;
+        }
+        else
+        {
+            mday -= 31 * 5;
+            month = (mday / 30) + 7;
+            day = (mday % 30) + 1;
+        }
+    }
+
+    result[0] = year;
+    result[1] = month;
+    result[2] = day;
+}
+
+void jdn_to_indian_civil(int32_t jdn, int32_t result[3])
+{
+    indian_civil(jdn, NULL, result);
+}
+
+void jdn_to_indian_civil_from_gregorian(int32_t jdn, int32_t gregorian_year, int32_t result[3])
+{
+    indian_civil(jdn, &gregorian_year, result);
+}
+
+// Incremental conversion
+
+static void (*const cursor_converters[])(int32_t jdn, int32_t result[3]) = {
+    jdn_to_gregorian, jdn_to_julian, jdn_to_hebrew, jdn_to_islamic, jdn_to_persian, jdn_to_indian_civil,
+};
+
+// Further than this, stepping month by month costs more than converting
+#define CURSOR_WALK_LIMIT 62
+
+static int32_t cursor_month_length(const date_cursor *cursor)
+{
+    static const uint8_t gregorian_days[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    int32_t year = cursor->date[0], month = cursor->date[1];
+
+    switch (cursor->calendar)
+    {
+    case CURSOR_GREGORIAN:
+        return gregorian_days[month - 1] + (month == 2 && leap_gregorian_int(year));
+    case CURSOR_JULIAN:
+        return gregorian_days[month - 1] + (month == 2 && leap_julian_int(year));
+    case CURSOR_HEBREW:
+        return hebrew_month_length(hebrew_to_jdn(year + 1, 7, 1) - hebrew_to_jdn(year, 7, 1), month);
+    case CURSOR_ISLAMIC:
+        return (month % 2 == 1 || (month == 12 && leap_islamic_int(year))) ? 30 : 29;
+    case CURSOR_PERSIAN:
+        return (month <= 6) ? 31 : (month <= 11 || leap_persian_int(year)) ? 30 : 29;
+    default: // CURSOR_INDIAN_CIVIL
+        return (month == 1) ? (leap_gregorian_int(year + 78) ? 31 : 30) : (month <= 6) ? 31 : 30;
+    }
+}
+
+// The Julian and Persian calendars go from year -1 straight to year 1
+static int32_t cursor_year_after(const date_cursor *cursor, int32_t year, int32_t step)
+{
+    year += step;
+    if (year == 0 && (cursor->calendar == CURSOR_JULIAN || cursor->calendar == CURSOR_PERSIAN))
+    {
+        year += step;
+    }
+    return year;
+}
+
+// Move to the first day of the next month
+static void cursor_next_month(date_cursor *cursor)
+{
+    int32_t jdn = cursor->jdn + cursor->month_length - cursor->date[2] + 1;
+    if (cursor->calendar == CURSOR_HEBREW)
+    {
+        cursor_set(cursor, CURSOR_HEBREW, jdn);
+        return;
+    }
+
+    cursor->jdn = jdn;
+    if (++cursor->date[1] > 12)
+    {
+        cursor->date[0] = cursor_year_after(cursor, cursor->date[0], 1);
+        cursor->date[1] = 1;
+    }
+    cursor->date[2] = 1;
+    cursor->month_length = cursor_month_length(cursor);
+}
+
+// Move to the last day of the previous month
+static void cursor_previous_month(date_cursor *cursor)
+{
+    int32_t jdn = cursor->jdn - cursor->date[2];
+    if (cursor->calendar == CURSOR_HEBREW)
+    {
+        cursor_set(cursor, CURSOR_HEBREW, jdn);
+        return;
+    }
+
+    cursor->jdn = jdn;
+    if (--cursor->date[1] < 1)
+    {
+        cursor->date[0] = cursor_year_after(cursor, cursor->date[0], -1);
+        cursor->date[1] = 12;
+    }
+    cursor->month_length = cursor_month_length(cursor);
+    cursor->date[2] = cursor->month_length;
+}
+
+void cursor_set(date_cursor *cursor, uint8_t calendar, int32_t jdn)
+{
+    cursor->calendar = calendar;
+    cursor->jdn = jdn;
+    cursor_converters[calendar](jdn, cursor->date);
+    cursor->month_length = cursor_month_length(cursor);
+}
+
+void cursor_add_days(date_cursor *cursor, int32_t days)
+{
+    int32_t target = cursor->jdn + days;
+    int32_t day = cursor->date[2] + days;
+
+    if (day < 1 || day > cursor->month_length)
+    {
+        if (days > CURSOR_WALK_LIMIT || days < -CURSOR_WALK_LIMIT)
+        {
+            cursor_set(cursor, cursor->calendar, target);
+            return;
+        }
+        while (target > cursor->jdn + (cursor->month_length - cursor->date[2]))
+        {
+            cursor_next_month(cursor);
+        }
+        while (target < cursor->jdn - (cursor->date[2] - 1))
+        {
+            cursor_previous_month(cursor);
+        }
+        day = cursor->date[2] + (target - cursor->jdn);
+    }
+
+    cursor->jdn = target;
+    cursor->date[2] = day;
+}
+
+void cursor_add_months(date_cursor *cursor, int32_t months)
+{
+    int32_t day = cursor->date[2];
+
+    for (; months > 0; months--)
+    {
+        cursor_next_month(cursor);
+    }
+    for (; months < 0; months++)
+    {
+        cursor_previous_month(cursor);
+    }
+
+    if (day > cursor->month_length)
+    {
+        day = cursor->month_length;
+    }
+    cursor->jdn += day - cursor->date[2];
+    cursor->date[2] = day;
+}
@@ -0,0 +1,146 @@
+/*
+ *--------------------------------------
+ * Program Name: CALCONV
+ * Author: Tomi Chen
+ * License: MIT
+ * Description: Integer calendar conversion kernel.
+ *
+ * Same algorithms as the ti::real converters, but on int32_t Julian Day
+ * Numbers (JDN = JD + 0.5) with exact floor division, so no OS floating
+ * point calls are needed.
+ *--------------------------------------
+ */
+
+#ifndef CALENDAR_INT_H
+#define CALENDAR_INT_H
+
+#include <stdint.h>
+
+// Floor division and modulus (the divisor is always positive in this file)
+
+static inline int32_t floor_div(int32_t a, int32_t b)
+{
+    return (a >= 0) ? (a / b) : -((b - 1 - a) / b);
+}
+
+static inline int32_t floor_mod(int32_t a, int32_t b)
+{
+    return a - floor_div(a, b) * b;
+}
+
+// Quotient and remainder of one floor division, for the decompositions that
+// need both
+
+static inline int32_t floor_divmod(int32_t a, int32_t b, int32_t *rem)
+{
+    int32_t q = floor_div(a, b);
+    *rem = a - q * b;
+    return q;
+}
+
+static inline int32_t ceil_div(int32_t a, int32_t b)
+{
+    return -floor_div(-a, b);
+}
+
+// Range: the kernel is exact for JDNs within +-JDN_LIMIT (about 237000 BCE
+// to 228000 CE), which are years within +-YEAR_LIMIT in every calendar.
+// Dates whose fields are within the limits below, counting past the end of
+// a month or year included, give a JDN whose JD still fits the 9 digits
+// bcd.h packs. Outside them some products no longer fit in an int32_t.
+
+#define JDN_LIMIT 85000000
+#define YEAR_LIMIT 250000
+#define MONTH_LIMIT 1000
+#define DAY_LIMIT 1000000
+
+// Baktuns, katuns, tuns and uinals of a Long Count; kins up to DAY_LIMIT
+#define LONG_COUNT_LIMIT 600
+
+static inline bool in_limit(int32_t value, int32_t limit)
+{
+    return value >= -limit && value <= limit;
+}
+
+static inline bool date_in_range(int32_t year, int32_t month, int32_t day)
+{
+    return in_limit(year, YEAR_LIMIT) && in_limit(month, MONTH_LIMIT) && in_limit(day, DAY_LIMIT);
+}
+
+static inline bool mayan_count_in_range(int32_t baktun, int32_t katun, int32_t tun, int32_t uinal, int32_t kin)
+{
+    return in_limit(baktun, LONG_COUNT_LIMIT) && in_limit(katun, LONG_COUNT_LIMIT) &&
+           in_limit(tun, LONG_COUNT_LIMIT) && in_limit(uinal, LONG_COUNT_LIMIT) && in_limit(kin, DAY_LIMIT);
+}
+
+// Gregorian
+
+bool leap_gregorian_int(int32_t year);
+int32_t gregorian_to_jdn(int32_t year, int32_t month, int32_t day);
+void jdn_to_gregorian(int32_t jdn, int32_t result[3]);
+
+// Julian
+
+bool leap_julian_int(int32_t year);
+int32_t julian_to_jdn(int32_t year, int32_t month, int32_t day);
+void jdn_to_julian(int32_t jdn, int32_t result[3]);
+
+// Hebrew
+
+int32_t hebrew_to_jdn(int32_t year, int32_t month, int32_t day);
+void jdn_to_hebrew(int32_t jdn, int32_t result[3]);
+
+// Islamic
+
+bool leap_islamic_int(int32_t year);
+int32_t islamic_to_jdn(int32_t year, int32_t month, int32_t day);
+void jdn_to_islamic(int32_t jdn, int32_t result[3]);
+
+// Persian
+
+bool leap_persian_int(int32_t year);
+int32_t persian_to_jdn(int32_t year, int32_t month, int32_t day);
+void jdn_to_persian(int32_t jdn, int32_t result[3]);
+
+// Mayan
+
+int32_t mayan_count_to_jdn(int32_t baktun, int32_t katun, int32_t tun, int32_t uinal, int32_t kin);
+void jdn_to_mayan_count(int32_t jdn, int32_t result[5]);
+void jdn_to_mayan_haab(int32_t jdn, int32_t result[2]);
+void jdn_to_mayan_tzolkin(int32_t jdn, int32_t result[2]);
+
+// Indian Civil
+
+int32_t indian_civil_to_jdn(int32_t year, int32_t month, int32_t day);
+void jdn_to_indian_civil(int32_t jdn, int32_t result[3]);
+// The same, for a caller that already has the Gregorian year of jdn
+void jdn_to_indian_civil_from_gregorian(int32_t jdn, int32_t gregorian_year, int32_t result[3]);
+
+// Incremental conversion: a date in one of the year/month/day calendars
+// kept together with its JDN and the length of its month, so that moving
+// to a nearby day or month only carries within the month and year instead
+// of converting the new JDN from scratch. Hebrew months are reconverted
+// whenever a step leaves the month, since their lengths depend on the year.
+
+#define CURSOR_GREGORIAN 0
+#define CURSOR_JULIAN 1
+#define CURSOR_HEBREW 2
+#define CURSOR_ISLAMIC 3
+#define CURSOR_PERSIAN 4
+#define CURSOR_INDIAN_CIVIL 5
+
+struct date_cursor
+{
+    uint8_t calendar;
+    int32_t jdn;
+    int32_t date[3]; // Year, month, day
+    int32_t month_length;
+};
+
+void cursor_set(date_cursor *cursor, uint8_t calendar, int32_t jdn);
+void cursor_add_days(date_cursor *cursor, int32_t days);
+
+// Keeps the day of the month, or the last day if the new month is shorter
+void cursor_add_months(date_cursor *cursor, int32_t months);
+
+#endif
@@ -0,0 +1,96 @@
+/*
+ *--------------------------------------
+ * Program Name: CALCONV
+ * Author: Tomi Chen
+ * License: MIT
+ * Description: Table-driven Chinese calendar.
+ *--------------------------------------
+ */
+
+#include "chinese.h"
+
+static uint8_t month_days(uint16_t index, uint8_t month)
+{
+    return ((chinese_years.month_lengths[index] >> month) & 1) ? 30 : 29;
+}
+
+int32_t chinese_to_jdn(int32_t year, int32_t month, bool leap, int32_t day)
+{
+    int32_t index = year - chinese_years.first_year;
+    if (index < 0 || index >= chinese_years.year_count)
+    {
+        return 0;
+    }
+
+    // Only the year's leap month (if any) may be marked as leap
+    uint8_t leap_month = chinese_years.leap_months[index];
+    if (month < 1 || month > 12 || (leap && month != leap_month))
+    {
+        return 0;
+    }
+
+    // Position of the month in the year, counting a leap month before it
+    uint8_t position = month - 1;
+    if (leap_month != 0 && (month > leap_month || (month == leap_month && leap)))
+    {
+        position++;
+    }
+    if (day < 1 || day > month_days(index, position))
+    {
+        return 0;
+    }
+
+    int32_t jdn = chinese_years.new_years[index];
+    for (uint8_t i = 0; i < position; i++)
+    {
+        jdn += month_days(index, i);
+    }
+    return jdn + day - 1;
+}
+
+void jdn_to_chinese(int32_t jdn, int32_t result[4])
+{
+    const int32_t *new_years = chinese_years.new_years;
+
+    result[0] = result[1] = result[2] = result[3] = 0;
+    if (jdn < new_years[0] || jdn >= new_years[chinese_years.year_count])
+    {
+        return;
+    }
+
+    // Last year starting on or before jdn
+    uint16_t low = 0, high = chinese_years.year_count - 1;
+    while (low < high)
+    {
+        uint16_t mid = (low + high + 1) / 2;
+        if (new_years[mid] <= jdn)
+        {
+            low = mid;
+        }
+        else
+        {
+            high = mid - 1;
+        }
+    }
+
+    int32_t day = jdn - new_years[low];
+    uint8_t position = 0;
+    while (day >= month_days(low, position))
+    {
+        day -= month_days(low, position++);
+    }
+
+    uint8_t leap_month = chinese_years.leap_months[low];
+    uint8_t month = position + 1;
+    bool leap = false;
+    if (leap_month != 0 && position >= leap_month)
+    {
+        month--;
+        leap = position == leap_month;
+    }
+
+    result[0] = chinese_years.first_year + low;
+    result[1] = month;
+    result[2] = leap;
+    result[3] = day + 1;
+}
@@ -0,0 +1,38 @@
+/*
+ *--------------------------------------
+ * Program Name: CALCONV
+ * Author: Tomi Chen
+ * License: MIT
+ * Description: Table-driven Chinese calendar.
+ *
+ * The Chinese calendar depends on the true new moons and solar terms, so
+ * instead of computing them the months of a fixed range of years are
+ * looked up in chinese_table_data.cpp, generated by tables/gen_chinese.cpp.
+ * Years are numbered by the Gregorian year their first month starts in.
+ *--------------------------------------
+ */
+
+#ifndef CHINESE_H
+#define CHINESE_H
+
+#include <stdint.h>
+
+struct chinese_table
+{
+    int32_t first_year;
+    uint16_t year_count;
+    const int32_t *new_years;      // JDN of month 1 day 1, plus one past the end
+    const uint16_t *month_lengths; // Bit i set if month i (leap included) has 30 days
+    const uint8_t *leap_months;    // Month followed by a leap month, 0 if none
+};
+
+extern const chinese_table chinese_years;
+
+// Both return 0 (and a zero date) outside the years in the table.
+// chinese_to_jdn also returns 0 for a month outside 1 to 12, a leap flag on
+// a month that isn't the year's leap month, or a day past the month's end.
+
+int32_t chinese_to_jdn(int32_t year, int32_t month, bool leap, int32_t day);
+void jdn_to_chinese(int32_t jdn, int32_t result[4]);
+
+#endif
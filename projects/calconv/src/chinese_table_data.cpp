@@ -0,0 +1,73 @@
+/*
+ * Generated by tables/gen_chinese.cpp, do not edit.
+ * Chinese years 1930 to 2100.
+ */
+
+#include "chinese.h"
+
+// JDN of the first day of each year, and of the year after the last
+
+static const int32_t chinese_new_years[172] = {
+    2426007, 2426390, 2426744, 2427099, 2427483, 2427838, 2428192, 2428576, 2428930, 2429314, 2429668, 2430022,
+    2430406, 2430761, 2431115, 2431500, 2431854, 2432208, 2432592, 2432946, 2433330, 2433684, 2434039, 2434423,
+    2434777, 2435132, 2435516, 2435870, 2436253, 2436608, 2436962, 2437346, 2437701, 2438055, 2438439, 2438794,
+    2439147, 2439531, 2439886, 2440270, 2440624, 2440979, 2441363, 2441717, 2442071, 2442455, 2442809, 2443193,
+    2443547, 2443902, 2444286, 2444641, 2444995, 2445379, 2445733, 2446117, 2446471, 2446825, 2447209, 2447564,
+    2447919, 2448303, 2448657, 2449011, 2449394, 2449749, 2450133, 2450487, 2450842, 2451226, 2451580, 2451934,
+    2452318, 2452672, 2453027, 2453411, 2453765, 2454150, 2454504, 2454858, 2455242, 2455596, 2455950, 2456334,
+    2456689, 2457073, 2457427, 2457782, 2458166, 2458520, 2458874, 2459258, 2459612, 2459967, 2460351, 2460705,
+    2461089, 2461443, 2461797, 2462181, 2462536, 2462890, 2463274, 2463629, 2464013, 2464367, 2464721, 2465105,
+    2465459, 2465813, 2466197, 2466552, 2466907, 2467291, 2467645, 2468029, 2468383, 2468737, 2469121, 2469475,
+    2469830, 2470214, 2470569, 2470953, 2471307, 2471661, 2472044, 2472399, 2472753, 2473137, 2473492, 2473846,
+    2474230, 2474584, 2474968, 2475322, 2475677, 2476061, 2476415, 2476770, 2477154, 2477508, 2477892, 2478246,
+    2478600, 2478984, 2479339, 2479693, 2480077, 2480432, 2480786, 2481170, 2481524, 2481908, 2482262, 2482617,
+    2483001, 2483355, 2483710, 2484093, 2484447, 2484831, 2485185, 2485540, 2485924, 2486279, 2486633, 2487017,
+    2487371, 2487725, 2488109, 2488463,
+};
+
+// Bit i set if month i of the year (counting a leap month) has 30 days
+
+static const uint16_t chinese_month_lengths[171] = {
+    0x0D26, 0x052B, 0x0A57, 0x12B6, 0x0B5A, 0x06D4, 0x0EC9, 0x0749, 0x1693, 0x0A93, 0x052B, 0x0A5B,
+    0x0AAD, 0x056A, 0x1B55, 0x0BA4, 0x0B49, 0x1A93, 0x0A95, 0x152D, 0x0536, 0x0AAD, 0x15AA, 0x05B2,
+    0x0DA5, 0x1D4A, 0x0D4A, 0x0A95, 0x0A97, 0x0556, 0x0AB5, 0x0AD5, 0x06D2, 0x0EA5, 0x0EA5, 0x064A,
+    0x0C97, 0x0A9B, 0x155A, 0x056A, 0x0B69, 0x1752, 0x0B52, 0x0B25, 0x164B, 0x0A4B, 0x14AB, 0x02AD,
+    0x056D, 0x0B69, 0x0DA9, 0x0D92, 0x1D25, 0x0D25, 0x1A4D, 0x0A56, 0x02B6, 0x05B5, 0x06D5, 0x0EA9,
+    0x1E92, 0x0E92, 0x0D26, 0x0A56, 0x0A57, 0x14D6, 0x035A, 0x06D5, 0x16C9, 0x0749, 0x0693, 0x152B,
+    0x052B, 0x0A5B, 0x155A, 0x056A, 0x1B55, 0x0BA4, 0x0B49, 0x1A93, 0x0A95, 0x052D, 0x0AAD, 0x0AB5,
+    0x15AA, 0x05D2, 0x0DA5, 0x1D4A, 0x0D4A, 0x0C95, 0x152E, 0x0556, 0x0AB5, 0x15B2, 0x06D2, 0x0EA5,
+    0x0725, 0x064B, 0x0C97, 0x0CAB, 0x055A, 0x0AD6, 0x0B69, 0x1752, 0x0B52, 0x0B25, 0x1A4B, 0x0A4B,
+    0x04AB, 0x055B, 0x05AD, 0x0B6A, 0x1B52, 0x0D92, 0x1D25, 0x0D25, 0x0A55, 0x14AD, 0x04B6, 0x05B5,
+    0x0DAA, 0x0EC9, 0x1E92, 0x0E92, 0x0D26, 0x0A56, 0x0A57, 0x0556, 0x06D5, 0x0755, 0x0749, 0x0E93,
+    0x0693, 0x152B, 0x052B, 0x0A5B, 0x155A, 0x056A, 0x0B65, 0x174A, 0x0B4A, 0x1A95, 0x0A95, 0x052D,
+    0x0AAD, 0x0AB5, 0x05AA, 0x0BA5, 0x0DA5, 0x0D4A, 0x1C95, 0x0C96, 0x194E, 0x0556, 0x0AB5, 0x15B2,
+    0x06D2, 0x0EA5, 0x0E4A, 0x068B, 0x0C97, 0x04AB, 0x055B, 0x0AD6, 0x0B6A, 0x0752, 0x1725, 0x0B45,
+    0x0A8B, 0x149B, 0x04AB,
+};
+
+// Month followed by a leap month, 0 if none
+
+static const uint8_t chinese_leap_months[171] = {
+    6, 0, 0, 5, 0, 0, 3, 0, 7, 0, 0, 6,
+    0, 0, 4, 0, 0, 2, 0, 7, 0, 0, 5, 0,
+    0, 3, 0, 8, 0, 0, 6, 0, 0, 4, 0, 0,
+    3, 0, 7, 0, 0, 5, 0, 0, 4, 0, 8, 0,
+    0, 6, 0, 0, 4, 0, 10, 0, 0, 6, 0, 0,
+    5, 0, 0, 3, 0, 8, 0, 0, 5, 0, 0, 4,
+    0, 0, 2, 0, 7, 0, 0, 5, 0, 0, 4, 0,
+    9, 0, 0, 6, 0, 0, 4, 0, 0, 2, 0, 6,
+    0, 0, 5, 0, 0, 3, 0, 11, 0, 0, 6, 0,
+    0, 5, 0, 0, 2, 0, 7, 0, 0, 5, 0, 0,
+    3, 0, 8, 0, 0, 6, 0, 0, 4, 0, 0, 3,
+    0, 7, 0, 0, 5, 0, 0, 4, 0, 8, 0, 0,
+    6, 0, 0, 4, 0, 0, 3, 0, 7, 0, 0, 5,
+    0, 0, 4, 0, 8, 0, 0, 6, 0, 0, 4, 0,
+    0, 2, 0,
+};
+
+const chinese_table chinese_years = {
+    1930, 171,
+    chinese_new_years,
+    chinese_month_lengths,
+    chinese_leap_months,
+};
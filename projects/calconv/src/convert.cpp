@@ -0,0 +1,256 @@
+/*
+ *--------------------------------------
+ * Program Name: CALCONV
+ * Author: Tomi Chen
+ * License: MIT
+ * Description: Run one conversion request stored in matrix J.
+ *--------------------------------------
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <ti/vars.h>
+
+#include "calendar.h"
+#include "convert.h"
+
+// Every selection code reads its inputs from consecutive columns of the
+// request row and writes its outputs from column 1 of the result row, so a
+// conversion is described by those two counts and a function on arrays.
+
+struct converter
+{
+    uint8_t inputs;
+    uint8_t outputs;
+    void (*run)(const real_t *in, real_t *out);
+};
+
+#define DATE_TO_JD(name)                                                          \
+    static void name##_row_to_jd(const real_t *in, real_t *out)                   \
+    {                                                                             \
+        out[0] = name##_to_jd(ti::real(in[0]), ti::real(in[1]), ti::real(in[2])); \
+    }
+
+#define JD_TO_DATE(name)                                          \
+    static void jd_to_##name##_row(const real_t *in, real_t *out) \
+    {                                                             \
+        jd_to_##name(ti::real(in[0]), out);                       \
+    }
+
+DATE_TO_JD(gregorian)
+JD_TO_DATE(gregorian)
+DATE_TO_JD(julian)
+JD_TO_DATE(julian)
+DATE_TO_JD(hebrew)
+JD_TO_DATE(hebrew)
+DATE_TO_JD(islamic)
+JD_TO_DATE(islamic)
+DATE_TO_JD(persian)
+JD_TO_DATE(persian)
+DATE_TO_JD(indian_civil)
+JD_TO_DATE(indian_civil)
+JD_TO_DATE(chinese)
+
+#undef DATE_TO_JD
+#undef JD_TO_DATE
+
+static void mayan_row_to_jd(const real_t *in, real_t *out)
+{
+    out[0] = mayan_count_to_jd(ti::real(in[0]), ti::real(in[1]), ti::real(in[2]), ti::real(in[3]), ti::real(in[4]));
+}
+
+// Long Count, then Haab, then Tzolkin
+static void jd_to_mayan_row(const real_t *in, real_t *out)
+{
+    ti::real jd(in[0]);
+    jd_to_mayan_count(jd, &out[0]);
+    jd_to_mayan_haab(jd, &out[5]);
+    jd_to_mayan_tzolkin(jd, &out[7]);
+}
+
+static void chinese_row_to_jd(const real_t *in, real_t *out)
+{
+    out[0] = chinese_to_jd(ti::real(in[0]), ti::real(in[1]), ti::real(in[2]), ti::real(in[3]));
+}
+
+// Indexed by selection code
+static const converter converters[] = {
+    {3, 1, gregorian_row_to_jd},
+    {1, 3, jd_to_gregorian_row},
+    {3, 1, julian_row_to_jd},
+    {1, 3, jd_to_julian_row},
+    {3, 1, hebrew_row_to_jd},
+    {1, 3, jd_to_hebrew_row},
+    {3, 1, islamic_row_to_jd},
+    {1, 3, jd_to_islamic_row},
+    {3, 1, persian_row_to_jd},
+    {1, 3, jd_to_persian_row},
+    {5, 1, mayan_row_to_jd},
+    {1, 9, jd_to_mayan_row},
+    {3, 1, indian_civil_row_to_jd},
+    {1, 3, jd_to_indian_civil_row},
+    {4, 1, chinese_row_to_jd},
+    {1, 4, jd_to_chinese_row},
+};
+
+#define SELECTION_COUNT (sizeof converters / sizeof converters[0])
+
+uint8_t selection_inputs(int24_t selection)
+{
+    if (selection >= FAN_OUT_SELECTION)
+    {
+        selection -= FAN_OUT_SELECTION;
+    }
+
+    return (selection >= 0 && selection < static_cast<int24_t>(SELECTION_COUNT)) ? converters[selection].inputs : 0;
+}
+
+uint8_t selection_outputs(int24_t selection)
+{
+    if (!selection_inputs(selection))
+    {
+        return 0;
+    }
+    if (selection < FAN_OUT_SELECTION)
+    {
+        return converters[selection].outputs;
+    }
+
+    uint8_t count = 1;
+    for (uint8_t i = 0; i < ALL_CALENDARS; i++)
+    {
+        count += all_calendar_widths[i];
+    }
+    return count;
+}
+
+uint8_t convert_values(int24_t selection, const real_t *in, real_t *out)
+{
+    if (!selection_inputs(selection))
+    {
+        return 0;
+    }
+    if (selection < FAN_OUT_SELECTION)
+    {
+        converters[selection].run(in, out);
+        return converters[selection].outputs;
+    }
+
+    int24_t source = selection - FAN_OUT_SELECTION;
+    if (source % 2 == 0)
+    {
+        converters[source].run(in, out);
+    }
+    else
+    {
+        out[0] = in[0];
+    }
+
+    real_t all[ALL_CALENDARS][ALL_CALENDARS_WIDTH];
+    jd_to_all(ti::real(out[0]), all);
+    uint8_t count = 1;
+    for (uint8_t i = 0; i < ALL_CALENDARS; i++)
+    {
+        memcpy(&out[count], all[i], all_calendar_widths[i] * sizeof(real_t));
+        count += all_calendar_widths[i];
+    }
+    return count;
+}
+
+// Archived variables live in flash, below this address
+#define RAM_START 0xD00000
+
+matrix_t *open_matrix(void)
+{
+    void *data;
+    if (!os_ChkFindSym(OS_TYPE_MATRIX, MATRIX, NULL, &data) || reinterpret_cast<uintptr_t>(data) < RAM_START)
+    {
+        return NULL;
+    }
+    return static_cast<matrix_t *>(data);
+}
+
+matrix_t *resize_matrix(matrix_t *matrix, int rows, int cols)
+{
+    if (matrix->rows >= rows && matrix->cols >= cols)
+    {
+        return matrix;
+    }
+
+    os_SetMatrixDims(MATRIX, (matrix->rows > rows) ? matrix->rows : rows,
+                     (matrix->cols > cols) ? matrix->cols : cols);
+    return open_matrix();
+}
+
+// How many of count columns starting at col fit in the given row of matrix
+static uint8_t columns_in(const matrix_t *matrix, int row, int col, uint8_t count)
+{
+    if (row < 1 || row > matrix->rows || col > matrix->cols)
+    {
+        return 0;
+    }
+    return (col + count - 1 > matrix->cols) ? matrix->cols - col + 1 : count;
+}
+
+static void read_row(matrix_t *matrix, int row, int col, real_t *values, uint8_t count)
+{
+    uint8_t present = columns_in(matrix, row, col, count);
+    if (present)
+    {
+        memcpy(values, &matrix_row(matrix, row)[col - 1], present * sizeof(real_t));
+    }
+    for (uint8_t i = present; i < count; i++)
+    {
+        values[i] = ti::make_real<0>();
+    }
+}
+
+static void write_row(matrix_t *matrix, int row, int col, const real_t *values, uint8_t count)
+{
+    uint8_t present = columns_in(matrix, row, col, count);
+    if (present)
+    {
+        memcpy(&matrix_row(matrix, row)[col - 1], values, present * sizeof(real_t));
+    }
+}
+
+void convert(matrix_t *matrix, int24_t selection, int in_row, int out_row)
+{
+    if (selection >= FAN_OUT_SELECTION)
+    {
+        return;
+    }
+
+    real_t in[MAX_SELECTION_INPUTS], out[MAX_SELECTION_OUTPUTS];
+    read_row(matrix, in_row, 2, in, selection_inputs(selection));
+    write_row(matrix, out_row, 1, out, convert_values(selection, in, out));
+}
+
+matrix_t *convert_all(matrix_t *matrix, int24_t source, int in_row, int out_row)
+{
+    int24_t selection = FAN_OUT_SELECTION + source;
+    if (!selection_inputs(selection))
+    {
+        return matrix;
+    }
+
+    matrix = resize_matrix(matrix, out_row + ALL_CALENDARS, ALL_CALENDARS_WIDTH);
+    if (!matrix)
+    {
+        return NULL;
+    }
+
+    real_t in[MAX_SELECTION_INPUTS], out[MAX_SELECTION_OUTPUTS];
+    read_row(matrix, in_row, 2, in, selection_inputs(selection));
+    convert_values(selection, in, out);
+
+    // The JD, then one calendar per row
+    write_row(matrix, out_row, 1, out, 1);
+    const real_t *next = &out[1];
+    for (uint8_t i = 0; i < ALL_CALENDARS; i++)
+    {
+        write_row(matrix, out_row + 1 + i, 1, next, all_calendar_widths[i]);
+        next += all_calendar_widths[i];
+    }
+    return matrix;
+}
@@ -0,0 +1,65 @@
+/*
+ *--------------------------------------
+ * Program Name: CALCONV
+ * Author: Tomi Chen
+ * License: MIT
+ * Description: Run one conversion request stored in matrix J.
+ *--------------------------------------
+ */
+
+#ifndef CONVERT_H
+#define CONVERT_H
+
+#include <ti/vars.h>
+
+#define MATRIX OS_VAR_MAT_J
+
+// Matrix J is looked up in the VAT once and then read and written in place
+// through its data, instead of paying for a lookup on every
+// os_GetMatrixElement / os_SetMatrixElement call. Returns NULL if J does
+// not exist or is archived.
+
+matrix_t *open_matrix(void);
+
+// Grows matrix J to at least rows x cols, keeping its elements. This moves
+// the variable, so only the returned pointer may be used afterwards.
+
+matrix_t *resize_matrix(matrix_t *matrix, int rows, int cols);
+
+// Elements are stored row by row; row is 1-based like the OS routines
+
+static inline real_t *matrix_row(matrix_t *matrix, int row)
+{
+    return &matrix->items[(row - 1) * matrix->cols];
+}
+
+// Read the request (inputs from column 2) in row in_row of matrix J and
+// write its result to out_row, starting at column 1. Inputs outside the
+// matrix read as 0 and outputs outside it are dropped.
+
+void convert(matrix_t *matrix, int24_t selection, int in_row, int out_row);
+
+// Fan-out: selection FAN_OUT_SELECTION + source converts the date in
+// in_row (laid out as for the usual selection source, an odd source means
+// column 2 holds a JD) to a JD in out_row and every calendar in the rows
+// below it, in the order of jd_to_all. Matrix J is enlarged to fit, and
+// the returned pointer replaces matrix as for resize_matrix.
+
+#define FAN_OUT_SELECTION 16
+
+matrix_t *convert_all(matrix_t *matrix, int24_t source, int in_row, int out_row);
+
+// The same conversions on plain arrays, for callers that don't go through
+// matrix J. selection_inputs gives how many values a selection reads, or 0
+// if it is not a valid selection, selection_outputs how many it writes,
+// and convert_values returns that count. A fan-out selection writes the JD followed by every calendar in
+// the order of jd_to_all, each only as wide as its result.
+
+#define MAX_SELECTION_INPUTS 5
+#define MAX_SELECTION_OUTPUTS 32
+
+uint8_t selection_inputs(int24_t selection);
+uint8_t selection_outputs(int24_t selection);
+uint8_t convert_values(int24_t selection, const real_t *in, real_t *out);
+
+#endif
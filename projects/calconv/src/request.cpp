@@ -0,0 +1,181 @@
+/*
+ *--------------------------------------
+ * Program Name: CALCONV
+ * Author: Tomi Chen
+ * License: MIT
+ * Description: Binary conversion requests through AppVars.
+ *--------------------------------------
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <ti/vars.h>
+
+#include "bcd.h"
+#include "calendar_int.h"
+#include "chinese.h"
+#include "convert.h"
+#include "request.h"
+
+#define RAM_START 0xD00000
+
+// Julian Days cross as JD = JDN - 0.5, everything else as whole numbers
+
+static real_t pack_field(int32_t value, bool jd)
+{
+    return jd ? bcd_pack(value * 10 - 5, 1) : bcd_pack(value, 0);
+}
+
+// Every result is a whole number or a JD ending in .5 well within 9 digits
+static int32_t unpack_field(const real_t *value, bool jd)
+{
+    int32_t result;
+    if (!bcd_unpack(value, jd, &result))
+    {
+        return 0;
+    }
+    return jd ? floor_div(result + 5, 10) : result;
+}
+
+// The AppVar's data in RAM, or NULL if it doesn't exist or is archived
+
+static var_t *find_appvar(const char *name)
+{
+    void *data;
+    if (!os_ChkFindSym(OS_TYPE_APPVAR, name, NULL, &data) || reinterpret_cast<uintptr_t>(data) < RAM_START)
+    {
+        return NULL;
+    }
+    return static_cast<var_t *>(data);
+}
+
+// Sources whose dates aren't a year, month and day
+#define MAYAN_SOURCE 10
+#define CHINESE_SOURCE 14
+
+// Reads the inputs of the record at data, returning false if they are
+// outside the range of the integer kernel (see calendar_int.h) or, for the
+// Chinese calendar, not a date in its table
+
+static bool read_fields(uint8_t selection, const uint8_t *data, uint8_t inputs, int32_t *fields)
+{
+    int24_t source = (selection >= FAN_OUT_SELECTION) ? selection - FAN_OUT_SELECTION : selection;
+
+    memcpy(fields, data, inputs * sizeof(int32_t));
+
+    // Odd selections take a JD
+    if (source % 2 == 1)
+    {
+        return in_limit(fields[0], JDN_LIMIT);
+    }
+    switch (source)
+    {
+    case MAYAN_SOURCE:
+        return mayan_count_in_range(fields[0], fields[1], fields[2], fields[3], fields[4]);
+    case CHINESE_SOURCE:
+        return chinese_to_jdn(fields[0], fields[1], fields[2] != 0, fields[3]) != 0;
+    default:
+        return date_in_range(fields[0], fields[1], fields[2]);
+    }
+}
+
+static void answer(uint8_t selection, const int32_t *fields, uint8_t inputs, uint8_t *response)
+{
+    int24_t source = (selection >= FAN_OUT_SELECTION) ? selection - FAN_OUT_SELECTION : selection;
+    real_t values[MAX_SELECTION_INPUTS], results[MAX_SELECTION_OUTPUTS];
+
+    for (uint8_t i = 0; i < inputs; i++)
+    {
+        values[i] = pack_field(fields[i], i == 0 && source % 2 == 1);
+    }
+
+    // Even selections and fan-out give a JD first
+    uint8_t count = convert_values(selection, values, results);
+    for (uint8_t i = 0; i < count; i++)
+    {
+        int32_t field = unpack_field(&results[i], i == 0 && (selection % 2 == 0 || selection >= FAN_OUT_SELECTION));
+        memcpy(&response[i * sizeof(int32_t)], &field, sizeof(int32_t));
+    }
+}
+
+// Walks the request, writing the response if it is given, and returns the
+// response's size. The first pass sizes the response AppVar, the second
+// fills it in.
+
+static uint16_t serve(const var_t *request, uint8_t *response)
+{
+    uint16_t pos = 1;
+    size_t length = 0;
+
+    if (request->size < 1 || request->data[0] != REQUEST_VERSION)
+    {
+        return 0;
+    }
+    if (response)
+    {
+        response[length] = REQUEST_VERSION;
+    }
+    length++;
+
+    while (pos < request->size)
+    {
+        uint8_t selection = request->data[pos++];
+        uint8_t inputs = selection_inputs(selection);
+        uint16_t record = inputs * sizeof(int32_t);
+        int32_t fields[MAX_SELECTION_INPUTS];
+        bool valid = inputs && request->size - pos >= record &&
+                     read_fields(selection, &request->data[pos], inputs, fields);
+        uint8_t count = valid ? selection_outputs(selection) : 0;
+
+        // Leave room for a record with a count of 0 to end the response
+        if (length + 2 * 2 + count * sizeof(int32_t) > MAX_RESPONSE_SIZE)
+        {
+            valid = false;
+            count = 0;
+        }
+
+        if (response)
+        {
+            response[length] = selection;
+            response[length + 1] = count;
+            if (valid)
+            {
+                answer(selection, fields, inputs, &response[length + 2]);
+            }
+        }
+        length += 2 + count * sizeof(int32_t);
+
+        if (!valid)
+        {
+            break;
+        }
+        pos += record;
+    }
+
+    return length;
+}
+
+bool serve_request_appvar(void)
+{
+    var_t *request = find_appvar(REQUEST_APPVAR);
+    if (!request)
+    {
+        return false;
+    }
+
+    if (find_appvar(RESPONSE_APPVAR))
+    {
+        os_DelAppVar(RESPONSE_APPVAR);
+    }
+
+    // Creating the response can move the request, so look it up again
+    var_t *response = os_CreateAppVar(RESPONSE_APPVAR, serve(request, NULL));
+    request = find_appvar(REQUEST_APPVAR);
+    if (response && request)
+    {
+        serve(request, response->data);
+    }
+
+    os_DelAppVar(REQUEST_APPVAR);
+    return true;
+}
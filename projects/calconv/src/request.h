@@ -0,0 +1,42 @@
+/*
+ *--------------------------------------
+ * Program Name: CALCONV
+ * Author: Tomi Chen
+ * License: MIT
+ * Description: Binary conversion requests through AppVars.
+ *
+ * An alternative to matrix J for programs that can write AppVars. The
+ * request AppVar holds REQUEST_VERSION and then any number of records,
+ * each a selection byte (the same codes as [J](1,1), fan-out included)
+ * followed by that selection's inputs as little-endian int32_t. Julian
+ * Days are sent and returned as whole Julian Day Numbers (JD + 0.5).
+ *
+ * The response AppVar holds REQUEST_VERSION and then, for each record,
+ * its selection byte, a count byte and count int32_t results. An invalid
+ * selection or a truncated record is answered with a count of 0 and ends
+ * the response. So is a record whose JD or date fields are outside the
+ * range in calendar_int.h, or whose Chinese date isn't in the table, and
+ * the first record whose answer would make the response larger than
+ * MAX_RESPONSE_SIZE. The request AppVar has to be in RAM, and is deleted
+ * once it has been answered.
+ *
+ * Both AppVars are handled through the VAT like matrix J, so ZCALCONV
+ * doesn't need the fileioc library.
+ *--------------------------------------
+ */
+
+#ifndef REQUEST_H
+#define REQUEST_H
+
+#define REQUEST_APPVAR "CALCREQ"
+#define RESPONSE_APPVAR "CALCRES"
+#define REQUEST_VERSION 1
+
+// Comfortably below the largest AppVar the OS can create
+#define MAX_RESPONSE_SIZE 65000
+
+// Answers the request AppVar; returns false if there is none
+
+bool serve_request_appvar(void);
+
+#endif
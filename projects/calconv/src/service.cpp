@@ -0,0 +1,111 @@
+/*
+ *--------------------------------------
+ * Program Name: CALCONV
+ * Author: Tomi Chen
+ * License: MIT
+ * Description: Resident conversion loop on the home screen.
+ *--------------------------------------
+ */
+
+#include <ti/real.h>
+#include <ti/screen.h>
+
+#include "calendar.h"
+#include "convert.h"
+#include "service.h"
+
+// Prompts for the inputs of each calendar's to-JD selection
+
+static const char *const ymd_fields[] = {"YEAR:", "MONTH:", "DAY:"};
+static const char *const long_count_fields[] = {"BAKTUN:", "KATUN:", "TUN:", "UINAL:", "KIN:"};
+static const char *const chinese_fields[] = {"YEAR:", "MONTH:", "LEAP:", "DAY:"};
+
+static const char *const *const calendar_fields[ALL_CALENDARS] = {
+    ymd_fields, ymd_fields, ymd_fields, ymd_fields, ymd_fields, long_count_fields, ymd_fields, chinese_fields,
+};
+
+static const char *input_prompt(int24_t selection, uint8_t input)
+{
+    int24_t source = (selection >= FAN_OUT_SELECTION) ? selection - FAN_OUT_SELECTION : selection;
+    return (source % 2 == 1) ? "JD:" : calendar_fields[source / 2][input];
+}
+
+// Returns false if nothing (or nothing numeric) was entered
+
+static bool read_real(const char *prompt, real_t *value)
+{
+    char buffer[24];
+    char *end;
+
+    os_GetStringInput(const_cast<char *>(prompt), buffer, sizeof buffer);
+    os_NewLine();
+    *value = os_StrToReal(buffer, &end);
+    return end != buffer;
+}
+
+// Prints count values on one line, separated by spaces
+
+static void print_values(const real_t *values, uint8_t count)
+{
+    char str[16];
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (i)
+        {
+            os_PutStrFull(" ");
+        }
+        os_RealToStr(str, &values[i], 0, 1, -1);
+        os_PutStrFull(str);
+    }
+    os_NewLine();
+}
+
+void run_service(void)
+{
+    os_ClrHome();
+    os_PutStrFull("ZCALCONV: empty input quits");
+    os_NewLine();
+
+    for (;;)
+    {
+        real_t value;
+        if (!read_real("SEL:", &value))
+        {
+            return;
+        }
+
+        int24_t selection = os_RealToInt24(&value);
+        uint8_t inputs = selection_inputs(selection);
+        if (!inputs)
+        {
+            os_PutStrFull("INVALID SELECTION");
+            os_NewLine();
+            continue;
+        }
+
+        real_t in[MAX_SELECTION_INPUTS], out[MAX_SELECTION_OUTPUTS];
+        for (uint8_t i = 0; i < inputs; i++)
+        {
+            if (!read_real(input_prompt(selection, i), &in[i]))
+            {
+                return;
+            }
+        }
+
+        uint8_t count = convert_values(selection, in, out);
+        if (selection < FAN_OUT_SELECTION)
+        {
+            print_values(out, count);
+            continue;
+        }
+
+        // Fan-out: the JD, then one calendar per line
+        print_values(out, 1);
+        const real_t *next = &out[1];
+        for (uint8_t i = 0; i < ALL_CALENDARS; i++)
+        {
+            print_values(next, all_calendar_widths[i]);
+            next += all_calendar_widths[i];
+        }
+    }
+}
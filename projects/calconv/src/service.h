@@ -0,0 +1,24 @@
+/*
+ *--------------------------------------
+ * Program Name: CALCONV
+ * Author: Tomi Chen
+ * License: MIT
+ * Description: Resident conversion loop on the home screen.
+ *
+ * Every launch of ZCALCONV pays for decompressing the program, relocating
+ * it and starting up the C runtime, which takes far longer than a
+ * conversion. In this mode ZCALCONV stays running and asks for one
+ * request after another (a selection code, then its inputs) until ENTER
+ * is pressed on an empty line.
+ *--------------------------------------
+ */
+
+#ifndef SERVICE_H
+#define SERVICE_H
+
+// [J](1,1) value that starts the loop
+#define SERVICE_SELECTION -2
+
+void run_service(void);
+
+#endif
@@ -0,0 +1,57 @@
+/*
+ *--------------------------------------
+ * Program Name: CALCONV
+ * Author: Tomi Chen
+ * License: MIT
+ * Description: Precomputed start-of-year tables.
+ *--------------------------------------
+ */
+
+#include "year_table.h"
+
+static uint16_t year_length(const year_table *table, uint16_t index)
+{
+    if (table->bits == 8)
+    {
+        return table->base_length + table->lengths[index];
+    }
+    return table->base_length + ((table->lengths[index >> 3] >> (index & 7)) & 1);
+}
+
+bool year_table_find(const year_table *table, int32_t jdn, int32_t *year, int32_t *start, int32_t *length)
+{
+    if (jdn < table->checkpoints[0] || jdn >= table->end_jdn)
+    {
+        return false;
+    }
+
+    // Last checkpoint at or before jdn
+    uint16_t low = 0, high = table->checkpoint_count - 1;
+    while (low < high)
+    {
+        uint16_t mid = (low + high + 1) / 2;
+        if (table->checkpoints[mid] <= jdn)
+        {
+            low = mid;
+        }
+        else
+        {
+            high = mid - 1;
+        }
+    }
+
+    // Then walk at most YEAR_TABLE_STRIDE years from it
+    uint16_t index = low * YEAR_TABLE_STRIDE;
+    int32_t year_start = table->checkpoints[low];
+    uint16_t days = year_length(table, index);
+    while (jdn >= year_start + days)
+    {
+        year_start += days;
+        days = year_length(table, ++index);
+    }
+
+    *year = table->first_year + index;
+    *start = year_start;
+    *length = days;
+    return true;
+}
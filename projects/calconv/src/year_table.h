@@ -0,0 +1,43 @@
+/*
+ *--------------------------------------
+ * Program Name: CALCONV
+ * Author: Tomi Chen
+ * License: MIT
+ * Description: Precomputed start-of-year tables.
+ *
+ * For the years people actually convert (about 1 BCE to 2500 CE), the
+ * start of every Hebrew, Islamic, Persian and Indian Civil year is stored
+ * as a checkpoint JDN every YEAR_TABLE_STRIDE years plus the length of
+ * each year relative to the shortest one. year_table_data.cpp is
+ * generated by tables/gen_tables.cpp.
+ *--------------------------------------
+ */
+
+#ifndef YEAR_TABLE_H
+#define YEAR_TABLE_H
+
+#include <stdint.h>
+
+#define YEAR_TABLE_STRIDE 32
+
+struct year_table
+{
+    int32_t first_year;          // Year starting at checkpoints[0]
+    int32_t end_jdn;             // First JDN after the last year in the table
+    uint16_t base_length;        // Length of the shortest year, in days
+    uint8_t bits;                // Bits per stored length: 1 or 8
+    uint16_t checkpoint_count;   // Entries in checkpoints
+    const int32_t *checkpoints;  // Start JDN of every YEAR_TABLE_STRIDE'th year
+    const uint8_t *lengths;      // Year length - base_length, packed LSB first
+};
+
+extern const year_table hebrew_year_table;
+extern const year_table islamic_year_table;
+extern const year_table persian_year_table;
+extern const year_table indian_civil_year_table;
+
+// Find the year containing jdn, returning false if it is outside the table
+
+bool year_table_find(const year_table *table, int32_t jdn, int32_t *year, int32_t *start, int32_t *length);
+
+#endif
@@ -0,0 +1,371 @@
+/*
+ * Generated by tables/gen_tables.cpp, do not edit.
+ * Years touching JDN 1721060 (1 BCE) to 2634531 (2500 CE).
+ */
+
+#include "year_table.h"
+
+// hebrew
+
+static const int32_t hebrew_checkpoints[79] = {
+    1720934, 1732629, 1744323, 1756018, 1767711, 1779375, 1791070, 1802764, 1814459, 1826153, 1837816, 1849512,
+    1861205, 1872899, 1884594, 1896258, 1907953, 1919646, 1931340, 1943004, 1954699, 1966394, 1978088, 1989781,
+    2001445, 2013140, 2024834, 2036529, 2048222, 2059888, 2071581, 2083275, 2094970, 2106664, 2118329, 2130023,
+    2141716, 2153410, 2165075, 2176769, 2188464, 2200157, 2211851, 2223516, 2235210, 2246905, 2258599, 2270292,
+    2281958, 2293651, 2305345, 2317040, 2328733, 2340399, 2352092, 2363786, 2375481, 2387145, 2398840, 2410534,
+    2422227, 2433921, 2445586, 2457280, 2468975, 2480668, 2492362, 2504027, 2515721, 2527416, 2539110, 2550803,
+    2562469, 2574162, 2585856, 2597551, 2609215, 2620910, 2632603,
+};
+
+static const uint8_t hebrew_lengths[2502] = {
+    32, 2, 30, 1, 2, 32, 1, 0, 32, 1, 30, 2,
+    1, 32, 0, 1, 32, 2, 0, 31, 2, 30, 2, 1,
+    32, 2, 1, 30, 2, 30, 1, 2, 32, 1, 0, 32,
+    1, 2, 30, 1, 32, 0, 2, 31, 2, 0, 31, 2,
+    30, 2, 1, 32, 2, 1, 30, 2, 1, 30, 2, 32,
+    1, 0, 32, 1, 2, 30, 1, 32, 0, 2, 31, 2,
+    0, 31, 2, 2, 30, 1, 32, 2, 1, 30, 2, 1,
+    32, 0, 32, 1, 2, 30, 1, 2, 30, 1, 2, 32,
+    0, 31, 2, 2, 30, 1, 2, 32, 1, 30, 2, 1,
+    30, 2, 1, 32, 0, 1, 32, 2, 30, 1, 2, 30,
+    2, 1, 32, 0, 31, 2, 2, 30, 1, 2, 32, 1,
+    0, 32, 1, 30, 2, 1, 32, 0, 2, 31, 2, 30,
+    1, 2, 30, 2, 1, 32, 2, 1, 30, 2, 30, 1,
+    2, 32, 1, 0, 32, 1, 32, 0, 1, 32, 2, 0,
+    31, 2, 2, 30, 1, 32, 0, 1, 32, 2, 1, 30,
+    2, 32, 1, 0, 32, 1, 2, 30, 1, 2, 30, 2,
+    31, 2, 0, 31, 2, 2, 30, 1, 32, 2, 1, 30,
+    2, 1, 30, 2, 1, 32, 0, 32, 1, 2, 30, 1,
+    2, 30, 2, 31, 2, 0, 31, 2, 2, 30, 1, 2,
+    32, 1, 30, 2, 1, 30, 2, 1, 32, 0, 32, 1,
+    2, 30, 1, 2, 32, 0, 1, 32, 2, 30, 1, 2,
+    30, 1, 2, 32, 1, 30, 2, 1, 32, 0, 1, 32,
+    2, 0, 31, 2, 30, 2, 1, 32, 2, 1, 30, 2,
+    30, 1, 2, 32, 1, 0, 32, 1, 2, 30, 1, 32,
+    0, 2, 31, 2, 0, 31, 2, 30, 2, 1, 32, 2,
+    1, 30, 2, 1, 30, 2, 32, 1, 0, 32, 1, 2,
+    30, 1, 32, 0, 2, 31, 2, 0, 31, 2, 2, 30,
+    1, 32, 2, 1, 30, 2, 1, 30, 2, 32, 1, 0,
+    32, 1, 2, 30, 1, 2, 32, 0, 31, 2, 2, 30,
+    1, 2, 32, 1, 30, 2, 1, 30, 2, 1, 32, 0,
+    1, 32, 2, 30, 1, 2, 30, 2, 1, 32, 0, 31,
+    2, 2, 30, 1, 2, 32, 1, 0, 32, 1, 30, 2,
+    1, 32, 0, 2, 31, 2, 30, 1, 2, 30, 2, 1,
+    32, 2, 1, 30, 2, 30, 1, 2, 32, 1, 0, 32,
+    1, 32, 0, 1, 32, 2, 0, 31, 2, 2, 30, 1,
+    32, 0, 1, 32, 2, 1, 30, 2, 32, 1, 0, 32,
+    1, 2, 30, 1, 2, 30, 1, 32, 2, 0, 31, 2,
+    2, 30, 1, 32, 2, 1, 30, 2, 1, 30, 2, 1,
+    32, 0, 32, 1, 2, 30, 1, 2, 30, 2, 31, 2,
+    0, 31, 2, 2, 30, 1, 2, 32, 1, 30, 2, 1,
+    30, 2, 1, 32, 0, 32, 1, 2, 30, 1, 2, 32,
+    0, 1, 32, 2, 30, 1, 2, 30, 1, 2, 32, 1,
+    30, 2, 1, 32, 0, 1, 32, 2, 0, 31, 2, 30,
+    1, 2, 32, 0, 1, 32, 2, 30, 1, 2, 32, 1,
+    0, 32, 1, 2, 30, 1, 32, 0, 2, 31, 2, 0,
+    31, 2, 30, 2, 1, 32, 2, 1, 30, 2, 1, 30,
+    2, 32, 1, 0, 32, 1, 2, 30, 1, 32, 0, 2,
+    31, 2, 0, 31, 2, 2, 30, 1, 32, 2, 1, 30,
+    2, 1, 30, 2, 32, 1, 0, 32, 1, 2, 30, 1,
+    2, 32, 0, 31, 2, 2, 30, 1, 2, 32, 1, 30,
+    2, 1, 30, 2, 1, 32, 0, 1, 32, 2, 30, 1,
+    2, 30, 2, 1, 32, 0, 31, 2, 2, 30, 1, 2,
+    32, 1, 0, 32, 1, 30, 2, 1, 32, 0, 2, 31,
+    2, 30, 1, 2, 30, 2, 1, 32, 2, 1, 30, 2,
+    30, 1, 2, 32, 1, 0, 32, 1, 30, 2, 1, 32,
+    0, 2, 31, 2, 0, 31, 2, 32, 0, 1, 32, 2,
+    1, 30, 2, 32, 1, 0, 32, 1, 2, 30, 1, 2,
+    30, 1, 32, 2, 0, 31, 2, 2, 30, 1, 32, 2,
+    1, 30, 2, 1, 30, 2, 1, 32, 0, 32, 1, 2,
+    30, 1, 2, 30, 2, 31, 2, 0, 31, 2, 2, 30,
+    1, 2, 32, 1, 30, 2, 1, 30, 2, 1, 32, 0,
+    32, 1, 2, 30, 1, 2, 32, 0, 1, 32, 2, 30,
+    1, 2, 30, 1, 2, 32, 1, 30, 2, 1, 32, 0,
+    1, 32, 2, 0, 31, 2, 30, 1, 2, 32, 0, 1,
+    32, 2, 30, 1, 2, 32, 1, 0, 32, 1, 2, 30,
+    1, 32, 0, 2, 31, 2, 0, 31, 2, 30, 2, 1,
+    32, 2, 1, 30, 2, 1, 30, 2, 32, 1, 0, 32,
+    1, 2, 30, 1, 32, 0, 2, 31, 2, 0, 31, 2,
+    2, 30, 1, 32, 2, 1, 30, 2, 1, 30, 2, 32,
+    1, 0, 32, 1, 2, 30, 1, 2, 32, 0, 31, 2,
+    2, 30, 1, 2, 30, 1, 32, 2, 1, 30, 2, 1,
+    32, 0, 1, 32, 2, 30, 1, 2, 30, 2, 1, 32,
+    0, 31, 2, 2, 30, 1, 2, 32, 1, 0, 32, 1,
+    30, 2, 1, 32, 0, 2, 31, 2, 30, 1, 2, 30,
+    2, 1, 32, 2, 1, 30, 2, 30, 1, 2, 32, 1,
+    0, 32, 1, 30, 2, 1, 32, 0, 2, 31, 2, 0,
+    31, 2, 32, 0, 1, 32, 2, 1, 30, 2, 32, 1,
+    0, 32, 1, 2, 30, 1, 2, 30, 1, 32, 2, 0,
+    31, 2, 2, 30, 1, 32, 2, 1, 30, 2, 1, 30,
+    2, 1, 32, 0, 32, 1, 2, 30, 1, 2, 30, 2,
+    31, 2, 0, 31, 2, 2, 30, 1, 2, 32, 1, 30,
+    2, 1, 30, 2, 1, 32, 0, 32, 1, 2, 30, 1,
+    2, 30, 2, 1, 32, 0, 31, 2, 2, 30, 1, 2,
+    32, 1, 30, 2, 1, 32, 0, 1, 32, 2, 0, 31,
+    2, 30, 1, 2, 32, 0, 1, 32, 2, 30, 1, 2,
+    32, 1, 0, 32, 1, 2, 30, 1, 32, 0, 1, 32,
+    2, 0, 31, 2, 30, 2, 1, 32, 2, 1, 30, 2,
+    1, 30, 2, 32, 1, 0, 32, 1, 2, 30, 1, 32,
+    0, 2, 31, 2, 0, 31, 2, 2, 30, 1, 32, 2,
+    1, 30, 2, 1, 30, 2, 32, 1, 0, 32, 1, 2,
+    30, 1, 2, 32, 0, 31, 2, 2, 30, 1, 2, 30,
+    1, 32, 2, 1, 30, 2, 1, 32, 0, 1, 32, 2,
+    30, 1, 2, 30, 2, 1, 32, 0, 31, 2, 2, 30,
+    1, 2, 32, 1, 0, 32, 1, 30, 2, 1, 32, 0,
+    2, 31, 2, 30, 1, 2, 30, 2, 1, 32, 2, 1,
+    30, 2, 30, 1, 2, 32, 1, 0, 32, 1, 30, 2,
+    1, 32, 0, 2, 31, 2, 0, 31, 2, 32, 0, 1,
+    32, 2, 1, 30, 2, 30, 1, 2, 32, 1, 0, 32,
+    1, 2, 30, 1, 32, 2, 0, 31, 2, 2, 30, 1,
+    32, 2, 1, 30, 2, 1, 30, 2, 1, 32, 0, 32,
+    1, 2, 30, 1, 2, 30, 2, 31, 2, 0, 31, 2,
+    2, 30, 1, 2, 32, 1, 30, 2, 1, 30, 2, 1,
+    32, 0, 32, 1, 2, 30, 1, 2, 30, 2, 1, 32,
+    0, 31, 2, 2, 30, 1, 2, 32, 1, 30, 2, 1,
+    30, 2, 1, 32, 0, 2, 31, 2, 30, 1, 2, 32,
+    0, 1, 32, 2, 30, 1, 2, 32, 1, 0, 32, 1,
+    2, 30, 1, 32, 0, 1, 32, 2, 0, 31, 2, 30,
+    2, 1, 32, 2, 1, 30, 2, 1, 30, 2, 32, 1,
+    0, 32, 1, 2, 30, 1, 32, 0, 2, 31, 2, 0,
+    31, 2, 2, 30, 1, 32, 2, 1, 30, 2, 1, 30,
+    2, 32, 1, 0, 32, 1, 2, 30, 1, 2, 32, 0,
+    31, 2, 2, 30, 1, 2, 30, 1, 32, 2, 1, 30,
+    2, 1, 32, 0, 1, 32, 2, 30, 1, 2, 30, 1,
+    2, 32, 0, 31, 2, 2, 30, 1, 2, 32, 1, 0,
+    32, 1, 30, 2, 1, 32, 0, 2, 31, 2, 30, 1,
+    2, 30, 2, 1, 32, 2, 1, 30, 2, 30, 1, 2,
+    32, 1, 0, 32, 1, 30, 2, 1, 32, 0, 2, 31,
+    2, 0, 31, 2, 32, 0, 1, 32, 2, 1, 30, 2,
+    30, 1, 2, 32, 1, 0, 32, 1, 2, 30, 1, 32,
+    2, 0, 31, 2, 2, 30, 1, 32, 0, 1, 32, 2,
+    1, 30, 2, 1, 32, 0, 32, 1, 2, 30, 1, 2,
+    30, 2, 31, 2, 0, 31, 2, 2, 30, 1, 2, 32,
+    1, 30, 2, 1, 30, 2, 1, 32, 0, 32, 1, 2,
+    30, 1, 2, 30, 2, 1, 32, 0, 31, 2, 2, 30,
+    1, 2, 32, 1, 30, 2, 1, 30, 2, 1, 32, 0,
+    2, 31, 2, 30, 1, 2, 32, 0, 1, 32, 2, 30,
+    1, 2, 32, 1, 0, 32, 1, 2, 30, 1, 32, 0,
+    1, 32, 2, 0, 31, 2, 30, 2, 1, 32, 2, 1,
+    30, 2, 1, 30, 2, 32, 1, 0, 32, 1, 2, 30,
+    1, 32, 0, 2, 31, 2, 0, 31, 2, 2, 30, 1,
+    32, 2, 1, 30, 2, 1, 30, 2, 32, 1, 0, 32,
+    1, 2, 30, 1, 2, 30, 2, 31, 2, 0, 31, 2,
+    2, 30, 1, 32, 2, 1, 30, 2, 1, 32, 0, 1,
+    32, 2, 30, 1, 2, 30, 1, 2, 32, 0, 31, 2,
+    2, 30, 1, 2, 32, 1, 0, 32, 1, 30, 2, 1,
+    32, 0, 1, 32, 2, 30, 1, 2, 30, 2, 1, 32,
+    2, 1, 30, 2, 30, 1, 2, 32, 1, 0, 32, 1,
+    30, 2, 1, 32, 0, 2, 31, 2, 0, 31, 2, 32,
+    0, 1, 32, 2, 1, 30, 2, 30, 1, 2, 32, 1,
+    0, 32, 1, 2, 30, 1, 32, 2, 0, 31, 2, 2,
+    30, 1, 32, 0, 1, 32, 2, 1, 30, 2, 1, 32,
+    0, 32, 1, 2, 30, 1, 2, 30, 2, 31, 2, 0,
+    31, 2, 2, 30, 1, 2, 32, 1, 30, 2, 1, 30,
+    2, 1, 32, 0, 32, 1, 2, 30, 1, 2, 30, 2,
+    1, 32, 0, 31, 2, 2, 30, 1, 2, 32, 1, 30,
+    2, 1, 30, 2, 1, 32, 0, 2, 31, 2, 30, 1,
+    2, 32, 0, 1, 32, 2, 30, 1, 2, 30, 1, 2,
+    32, 1, 0, 32, 1, 32, 0, 1, 32, 2, 0, 31,
+    2, 30, 2, 1, 32, 2, 1, 30, 2, 1, 30, 2,
+    32, 1, 0, 32, 1, 2, 30, 1, 32, 0, 2, 31,
+    2, 0, 31, 2, 2, 30, 1, 32, 2, 1, 30, 2,
+    1, 30, 2, 32, 1, 0, 32, 1, 2, 30, 1, 2,
+    30, 2, 31, 2, 0, 31, 2, 2, 30, 1, 32, 2,
+    1, 30, 2, 1, 32, 0, 1, 32, 2, 30, 1, 2,
+    30, 1, 2, 32, 0, 31, 2, 2, 30, 1, 2, 32,
+    1, 0, 32, 1, 30, 2, 1, 32, 0, 1, 32, 2,
+    30, 1, 2, 30, 2, 1, 32, 2, 1, 30, 2, 30,
+    1, 2, 32, 1, 0, 32, 1, 30, 2, 1, 32, 0,
+    2, 31, 2, 0, 31, 2, 30, 2, 1, 32, 2, 1,
+    30, 2, 30, 1, 2, 32, 1, 0, 32, 1, 2, 30,
+    1, 32, 2, 0, 31, 2, 2, 30, 1, 32, 0, 1,
+    32, 2, 1, 30, 2, 1, 32, 0, 32, 1, 2, 30,
+    1, 2, 30, 1, 32, 2, 0, 31, 2, 2, 30, 1,
+    2, 32, 1, 30, 2, 1, 30, 2, 1, 32, 0, 32,
+    1, 2, 30, 1, 2, 30, 2, 1, 32, 0, 31, 2,
+    2, 30, 1, 2, 32, 1, 30, 2, 1, 30, 2, 1,
+    32, 0, 2, 31, 2, 30, 1, 2, 32, 0, 1, 32,
+    2, 30, 1, 2, 30, 1, 2, 32, 1, 0, 32, 1,
+    32, 0, 1, 32, 2, 0, 31, 2, 30, 2, 1, 32,
+    2, 1, 30, 2, 1, 30, 2, 32, 1, 0, 32, 1,
+    2, 30, 1, 32, 0, 2, 31, 2, 0, 31, 2, 2,
+    30, 1, 32, 2, 1, 30, 2, 1, 30, 2, 32, 1,
+    0, 32, 1, 2, 30, 1, 2, 30, 2, 31, 2, 0,
+    31, 2, 2, 30, 1, 32, 2, 1, 30, 2, 1, 30,
+    2, 1, 32, 0, 32, 1, 2, 30, 1, 2, 32, 0,
+    31, 2, 2, 30, 1, 2, 32, 1, 0, 32, 1, 30,
+    2, 1, 32, 0, 1, 32, 2, 30, 1, 2, 30, 2,
+    1, 32, 2, 1, 30, 2, 30, 1, 2, 32, 1, 0,
+    32, 1, 30, 2, 1, 32, 0, 2, 31, 2, 0, 31,
+    2, 30, 2, 1, 32, 2, 1, 30, 2, 30, 1, 2,
+    32, 1, 0, 32, 1, 2, 30, 1, 32, 0, 2, 31,
+    2, 0, 31, 2, 32, 0, 1, 32, 2, 1, 30, 2,
+    1, 32, 0, 32, 1, 2, 30, 1, 2, 30, 1, 32,
+    2, 0, 31, 2, 2, 30, 1, 2, 32, 1, 30, 2,
+    1, 30, 2, 1, 32, 0, 32, 1, 2, 30, 1, 2,
+    30, 2, 1, 32, 0, 31, 2, 2, 30, 1, 2, 32,
+    1, 30, 2, 1, 30, 2, 1, 32, 0, 2, 31, 2,
+    30, 1, 2, 32, 0, 1, 32, 2, 30, 1, 2, 30,
+    1, 2, 32, 1, 0, 32, 1, 32, 0, 1, 32, 2,
+    0, 31, 2, 30, 1, 2, 32, 0, 1, 32, 2, 1,
+    30, 2, 32, 1, 0, 32, 1, 2, 30, 1, 32, 0,
+    2, 31, 2, 0, 31, 2, 2, 30, 1, 32, 2, 1,
+    30, 2, 1, 30, 2, 32, 1, 0, 32, 1, 2, 30,
+    1, 2, 30, 2, 31, 2, 0, 31, 2, 2, 30, 1,
+    32, 2, 1, 30, 2, 1, 30, 2, 1, 32, 0, 32,
+    1, 2, 30, 1, 2, 32, 0, 31, 2, 2, 30, 1,
+    2, 30, 1, 2, 32, 1, 30, 2, 1, 32, 0, 1,
+    32, 2, 30, 1, 2, 30, 2, 1, 32, 2, 1, 30,
+    2, 30, 1, 2, 32, 1, 0, 32, 1, 30, 2, 1,
+    32, 0, 2, 31, 2, 0, 31, 2, 30, 2, 1, 32,
+    2, 1, 30, 2, 30, 1, 2, 32, 1, 0, 32, 1,
+    2, 30, 1, 32, 0, 2, 31, 2, 0, 31, 2, 32,
+    0, 1, 32, 2, 1, 30, 2, 1, 32, 0, 32, 1,
+    2, 30, 1, 2, 30, 1, 32, 2, 0, 31, 2, 2,
+    30, 1, 2, 32, 1, 30, 2, 1, 30, 2, 1, 32,
+    0, 32, 1, 2, 30, 1, 2, 30, 2, 1, 32, 0,
+    31, 2, 2, 30, 1, 2, 32, 1, 30, 2, 1, 30,
+    2, 1, 32, 0, 2, 31, 2, 30, 1, 2, 30, 2,
+    1, 32, 0, 31, 2, 2,
+};
+
+const year_table hebrew_year_table = {
+    3760, 2634789, 353, 8, 79,
+    hebrew_checkpoints,
+    hebrew_lengths,
+};
+
+// islamic
+
+static const int32_t islamic_checkpoints[81] = {
+    1720937, 1732276, 1743616, 1754956, 1766296, 1777635, 1788975, 1800315, 1811654, 1822994, 1834334, 1845674,
+    1857013, 1868353, 1879693, 1891033, 1902372, 1913712, 1925052, 1936392, 1947731, 1959071, 1970411, 1981750,
+    1993090, 2004430, 2015770, 2027109, 2038449, 2049789, 2061129, 2072468, 2083808, 2095148, 2106488, 2117827,
+    2129167, 2140507, 2151846, 2163186, 2174526, 2185866, 2197205, 2208545, 2219885, 2231225, 2242564, 2253904,
+    2265244, 2276584, 2287923, 2299263, 2310603, 2321942, 2333282, 2344622, 2355962, 2367301, 2378641, 2389981,
+    2401321, 2412660, 2424000, 2435340, 2446680, 2458019, 2469359, 2480699, 2492038, 2503378, 2514718, 2526058,
+    2537397, 2548737, 2560077, 2571417, 2582756, 2594096, 2605436, 2616776, 2628115,
+};
+
+static const uint8_t islamic_lengths[323] = {
+    164, 36, 37, 41, 41, 73, 73, 74, 74, 82, 146, 146,
+    146, 148, 164, 164, 36, 37, 41, 41, 73, 73, 74, 74,
+    82, 146, 146, 146, 148, 164, 164, 36, 37, 41, 41, 73,
+    73, 74, 74, 82, 146, 146, 146, 148, 164, 164, 36, 37,
+    41, 41, 73, 73, 74, 74, 82, 146, 146, 146, 148, 164,
+    164, 36, 37, 41, 41, 73, 73, 74, 74, 82, 146, 146,
+    146, 148, 164, 164, 36, 37, 41, 41, 73, 73, 74, 74,
+    82, 146, 146, 146, 148, 164, 164, 36, 37, 41, 41, 73,
+    73, 74, 74, 82, 146, 146, 146, 148, 164, 164, 36, 37,
+    41, 41, 73, 73, 74, 74, 82, 146, 146, 146, 148, 164,
+    164, 36, 37, 41, 41, 73, 73, 74, 74, 82, 146, 146,
+    146, 148, 164, 164, 36, 37, 41, 41, 73, 73, 74, 74,
+    82, 146, 146, 146, 148, 164, 164, 36, 37, 41, 41, 73,
+    73, 74, 74, 82, 146, 146, 146, 148, 164, 164, 36, 37,
+    41, 41, 73, 73, 74, 74, 82, 146, 146, 146, 148, 164,
+    164, 36, 37, 41, 41, 73, 73, 74, 74, 82, 146, 146,
+    146, 148, 164, 164, 36, 37, 41, 41, 73, 73, 74, 74,
+    82, 146, 146, 146, 148, 164, 164, 36, 37, 41, 41, 73,
+    73, 74, 74, 82, 146, 146, 146, 148, 164, 164, 36, 37,
+    41, 41, 73, 73, 74, 74, 82, 146, 146, 146, 148, 164,
+    164, 36, 37, 41, 41, 73, 73, 74, 74, 82, 146, 146,
+    146, 148, 164, 164, 36, 37, 41, 41, 73, 73, 74, 74,
+    82, 146, 146, 146, 148, 164, 164, 36, 37, 41, 41, 73,
+    73, 74, 74, 82, 146, 146, 146, 148, 164, 164, 36, 37,
+    41, 41, 73, 73, 74, 74, 82, 146, 146, 146, 148, 164,
+    164, 36, 37, 41, 41, 73, 73, 74, 74, 82, 146, 146,
+    146, 148, 164, 164, 36, 37, 41, 41, 73, 73, 2,
+};
+
+const year_table islamic_year_table = {
+    -641, 2634848, 354, 1, 81,
+    islamic_checkpoints,
+    islamic_lengths,
+};
+
+// persian
+
+static const int32_t persian_checkpoints[59] = {
+    1948321, 1960008, 1971696, 1983384, 1995072, 2006759, 2018447, 2030135, 2041823, 2053510, 2065198, 2076886,
+    2088574, 2100261, 2111949, 2123637, 2135325, 2147012, 2158700, 2170388, 2182076, 2193763, 2205451, 2217139,
+    2228827, 2240514, 2252202, 2263890, 2275578, 2287265, 2298953, 2310641, 2322329, 2334016, 2345704, 2357392,
+    2369080, 2380767, 2392455, 2404143, 2415831, 2427518, 2439206, 2450894, 2462582, 2474269, 2485957, 2497645,
+    2509333, 2521020, 2532708, 2544396, 2556084, 2567771, 2579459, 2591147, 2602835, 2614522, 2626210,
+};
+
+static const uint8_t persian_lengths[235] = {
+    136, 136, 8, 17, 17, 17, 17, 34, 34, 34, 34, 68,
+    68, 68, 132, 136, 136, 136, 8, 17, 17, 17, 17, 34,
+    34, 34, 34, 68, 68, 68, 132, 136, 136, 136, 8, 17,
+    17, 17, 17, 34, 34, 34, 34, 68, 68, 68, 132, 136,
+    136, 136, 8, 17, 17, 17, 17, 34, 34, 34, 34, 66,
+    68, 68, 68, 136, 136, 136, 136, 16, 17, 17, 17, 33,
+    34, 34, 34, 66, 68, 68, 68, 136, 136, 136, 136, 16,
+    17, 17, 17, 33, 34, 34, 34, 66, 68, 68, 68, 136,
+    136, 136, 136, 16, 17, 17, 17, 33, 34, 34, 34, 66,
+    68, 68, 68, 136, 136, 136, 136, 16, 17, 17, 17, 33,
+    34, 34, 34, 66, 68, 68, 68, 136, 136, 136, 136, 16,
+    17, 17, 17, 33, 34, 34, 34, 66, 68, 68, 68, 136,
+    136, 136, 136, 16, 17, 17, 17, 33, 34, 34, 34, 66,
+    68, 68, 68, 136, 136, 136, 136, 16, 17, 17, 17, 33,
+    34, 34, 34, 66, 68, 68, 68, 136, 136, 136, 136, 16,
+    17, 17, 17, 33, 34, 34, 34, 66, 68, 68, 68, 136,
+    136, 136, 136, 16, 17, 17, 17, 33, 34, 34, 34, 66,
+    68, 68, 68, 136, 136, 136, 136, 16, 17, 17, 17, 33,
+    34, 34, 34, 66, 68, 68, 68, 136, 136, 136, 136, 16,
+    17, 17, 17, 33, 34, 34, 34,
+};
+
+const year_table persian_year_table = {
+    1, 2634611, 365, 1, 59,
+    persian_checkpoints,
+    persian_lengths,
+};
+
+// indian_civil
+
+static const int32_t indian_civil_checkpoints[79] = {
+    1720775, 1732463, 1744151, 1755839, 1767526, 1779214, 1790902, 1802589, 1814277, 1825965, 1837652, 1849340,
+    1861028, 1872716, 1884404, 1896092, 1907779, 1919467, 1931155, 1942842, 1954530, 1966218, 1977905, 1989593,
+    2001281, 2012969, 2024657, 2036345, 2048033, 2059720, 2071408, 2083096, 2094783, 2106471, 2118159, 2129846,
+    2141534, 2153222, 2164910, 2176598, 2188286, 2199973, 2211661, 2223349, 2235036, 2246724, 2258412, 2270099,
+    2281787, 2293475, 2305163, 2316851, 2328539, 2340227, 2351914, 2363602, 2375290, 2386977, 2398665, 2410353,
+    2422040, 2433728, 2445416, 2457104, 2468792, 2480480, 2492167, 2503855, 2515543, 2527230, 2538918, 2550606,
+    2562293, 2573981, 2585669, 2597357, 2609045, 2620733, 2632421,
+};
+
+static const uint8_t indian_civil_lengths[313] = {
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    2, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 32, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 2, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 2, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 32, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 2, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 2, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 32, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 2, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 2, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 32, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 2, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 2, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 32, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 2, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 2, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 32,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 2,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    2,
+};
+
+const year_table indian_civil_year_table = {
+    -79, 2634612, 365, 1, 79,
+    indian_civil_checkpoints,
+    indian_civil_lengths,
+};
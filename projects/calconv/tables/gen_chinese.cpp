@@ -0,0 +1,301 @@
+/*
+ *--------------------------------------
+ * Program Name: CALCONV
+ * Author: Tomi Chen
+ * License: MIT
+ * Description: Generate src/chinese_table_data.cpp.
+ *
+ * Works out the Chinese calendar for 1930 to 2100 from first principles:
+ * new moons from Meeus, Astronomical Algorithms, chapter 49, and the
+ * apparent solar longitude from chapter 25, both converted from TT to
+ * Beijing civil time. Months start on the day of the new moon, the
+ * winter solstice is always in month 11, and a year with 13 months
+ * between solstice months repeats the first month with no major solar
+ * term (a multiple of 30 degrees of solar longitude) as a leap month.
+ *
+ * Earlier years are left out: calendars before the 1929 switch to UTC+8
+ * were computed with older theory, and this does not reproduce all of
+ * them (1917 and 1922 get a different leap month).
+ *--------------------------------------
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+#include "calendar_int.h"
+
+#define FIRST_YEAR 1930
+#define LAST_YEAR 2100
+#define VALUES_PER_LINE 12
+
+#define SYNODIC_MONTH 29.530588861
+#define TROPICAL_YEAR 365.242189
+
+static double radians(double degrees)
+{
+    return degrees * M_PI / 180;
+}
+
+static double normalize(double degrees)
+{
+    degrees = fmod(degrees, 360);
+    return (degrees < 0) ? degrees + 360 : degrees;
+}
+
+// JDE (TT) of new moon number k, counted from the one of 2000-01-06
+
+static double new_moon(int k)
+{
+    double T = k / 1236.85;
+    double jde = 2451550.09766 + SYNODIC_MONTH * k + 0.00015437 * T * T -
+                 0.000000150 * T * T * T + 0.00000000073 * T * T * T * T;
+    double E = 1 - 0.002516 * T - 0.0000074 * T * T;
+    double M = radians(2.5534 + 29.10535670 * k - 0.0000014 * T * T - 0.00000011 * T * T * T);
+    double Mp = radians(201.5643 + 385.81693528 * k + 0.0107582 * T * T + 0.00001238 * T * T * T -
+                        0.000000058 * T * T * T * T);
+    double F = radians(160.7108 + 390.67050284 * k - 0.0016118 * T * T - 0.00000227 * T * T * T +
+                       0.000000011 * T * T * T * T);
+    double O = radians(124.7746 - 1.56375588 * k + 0.0020672 * T * T + 0.00000215 * T * T * T);
+
+    jde += -0.40720 * sin(Mp) + 0.17241 * E * sin(M) + 0.01608 * sin(2 * Mp) +
+           0.01039 * sin(2 * F) + 0.00739 * E * sin(Mp - M) - 0.00514 * E * sin(Mp + M) +
+           0.00208 * E * E * sin(2 * M) - 0.00111 * sin(Mp - 2 * F) - 0.00057 * sin(Mp + 2 * F) +
+           0.00056 * E * sin(2 * Mp + M) - 0.00042 * sin(3 * Mp) + 0.00042 * E * sin(M + 2 * F) +
+           0.00038 * E * sin(M - 2 * F) - 0.00024 * E * sin(2 * Mp - M) - 0.00017 * sin(O) -
+           0.00007 * sin(Mp + 2 * M) + 0.00004 * sin(2 * Mp - 2 * F) + 0.00004 * sin(3 * M) +
+           0.00003 * sin(Mp + M - 2 * F) + 0.00003 * sin(2 * Mp + 2 * F) -
+           0.00003 * sin(Mp + M + 2 * F) + 0.00003 * sin(Mp - M + 2 * F) -
+           0.00002 * sin(Mp - M - 2 * F) - 0.00002 * sin(3 * Mp + M) + 0.00002 * sin(4 * Mp);
+
+    static const double planetary[14][3] = {
+        {0.000325, 299.77, 0.107408}, {0.000165, 251.88, 0.016321}, {0.000164, 251.83, 26.651886},
+        {0.000126, 349.42, 36.412478}, {0.000110, 84.66, 18.206239}, {0.000062, 141.74, 53.303771},
+        {0.000060, 207.14, 2.453732}, {0.000056, 154.84, 7.306860}, {0.000047, 34.52, 27.261239},
+        {0.000042, 207.19, 0.121824}, {0.000040, 291.34, 1.844379}, {0.000037, 161.72, 24.198154},
+        {0.000035, 239.56, 25.513099}, {0.000023, 331.55, 3.592518},
+    };
+    for (int i = 0; i < 14; i++)
+    {
+        double A = planetary[i][1] + planetary[i][2] * k - ((i == 0) ? 0.009173 * T * T : 0);
+        jde += planetary[i][0] * sin(radians(A));
+    }
+
+    return jde;
+}
+
+// Apparent geocentric longitude of the sun in degrees at a JDE
+
+static double solar_longitude(double jde)
+{
+    double T = (jde - 2451545) / 36525;
+    double L0 = 280.46646 + 36000.76983 * T + 0.0003032 * T * T;
+    double M = radians(357.52911 + 35999.05029 * T - 0.0001537 * T * T);
+    double C = (1.914602 - 0.004817 * T - 0.000014 * T * T) * sin(M) +
+               (0.019993 - 0.000101 * T) * sin(2 * M) + 0.000289 * sin(3 * M);
+    double O = radians(125.04 - 1934.136 * T);
+
+    return normalize(L0 + C - 0.00569 - 0.00478 * sin(O));
+}
+
+// JDE at which the solar longitude reaches the given angle, near jde
+
+static double solar_term(double angle, double jde)
+{
+    for (int i = 0; i < 20; i++)
+    {
+        double error = normalize(angle - solar_longitude(jde) + 180) - 180;
+        jde += error * TROPICAL_YEAR / 360;
+        if (fabs(error) < 1e-7)
+        {
+            break;
+        }
+    }
+    return jde;
+}
+
+// Civil date (JDN) in Beijing (UTC+8) of a JDE, going from TT to UT with
+// the Espenak-Meeus delta T polynomials
+
+static int32_t beijing_jdn(double jde)
+{
+    double y = 2000 + (jde - 2451544.5) / TROPICAL_YEAR, t, delta_t;
+
+    if (y < 1941)
+    {
+        t = y - 1920;
+        delta_t = 21.20 + 0.84493 * t - 0.076100 * t * t + 0.0020936 * t * t * t;
+    }
+    else if (y < 1961)
+    {
+        t = y - 1950;
+        delta_t = 29.07 + 0.407 * t - t * t / 233 + t * t * t / 2547;
+    }
+    else if (y < 1986)
+    {
+        t = y - 1975;
+        delta_t = 45.45 + 1.067 * t - t * t / 260 - t * t * t / 718;
+    }
+    else if (y < 2005)
+    {
+        t = y - 2000;
+        delta_t = 63.86 + 0.3345 * t - 0.060374 * t * t + 0.0017275 * t * t * t +
+                  0.000651814 * t * t * t * t + 0.00002373599 * t * t * t * t * t;
+    }
+    else if (y < 2050)
+    {
+        t = y - 2000;
+        delta_t = 62.92 + 0.32217 * t + 0.005589 * t * t;
+    }
+    else if (y < 2150)
+    {
+        delta_t = -20 + 32 * ((y - 1820) / 100) * ((y - 1820) / 100) - 0.5628 * (2150 - y);
+    }
+    else
+    {
+        delta_t = -20 + 32 * ((y - 1820) / 100) * ((y - 1820) / 100);
+    }
+
+    return static_cast<int32_t>(floor(jde - delta_t / 86400 + 8.0 / 24 + 0.5));
+}
+
+struct month
+{
+    int32_t start;
+    int number;
+    bool leap;
+};
+
+// Index of a new moon shortly before a JDE
+
+static int first_new_moon_index(double jde)
+{
+    return static_cast<int>(ceil((jde - 2451550.09766) / SYNODIC_MONTH)) - 1;
+}
+
+// Months from the month 11 containing the winter solstice of year - 1 up
+// to (not including) the one containing the solstice of year
+
+static void sui_months(int year, std::vector<month> &months)
+{
+    int32_t solstice1 = beijing_jdn(solar_term(270, gregorian_to_jdn(year - 1, 12, 21)));
+    int32_t solstice2 = beijing_jdn(solar_term(270, gregorian_to_jdn(year, 12, 21)));
+
+    // Month 11 starts on the last new moon day on or before each solstice
+    int k = first_new_moon_index(solstice1 - 40);
+    while (beijing_jdn(new_moon(k + 1)) <= solstice1)
+    {
+        k++;
+    }
+    int k_end = k;
+    while (beijing_jdn(new_moon(k_end + 1)) <= solstice2)
+    {
+        k_end++;
+    }
+
+    bool leap_year = (k_end - k) == 13, leap_found = false;
+    int number = 11;
+    for (int i = k; i < k_end; i++)
+    {
+        int32_t start = beijing_jdn(new_moon(i));
+        int32_t end = beijing_jdn(new_moon(i + 1));
+        bool leap = false;
+
+        if (leap_year && !leap_found && i != k)
+        {
+            // Does a major solar term fall on or after the first day?
+            double angle = 30 * floor(solar_longitude(new_moon(i) - 1) / 30) + 30;
+            int32_t term = beijing_jdn(solar_term(normalize(angle), new_moon(i)));
+            if (term < start)
+            {
+                term = beijing_jdn(solar_term(normalize(angle + 30), new_moon(i) + 15));
+            }
+            leap = term >= end;
+            leap_found = leap;
+        }
+
+        if (!leap && i != k)
+        {
+            number = (number % 12) + 1;
+        }
+        months.push_back({start, number, leap});
+    }
+}
+
+int main(void)
+{
+    std::vector<month> months;
+    for (int year = FIRST_YEAR; year <= LAST_YEAR + 1; year++)
+    {
+        sui_months(year, months);
+    }
+
+    // Split into years at each (non-leap) month 1
+    std::vector<int32_t> new_years, lengths, leaps;
+    size_t first = 0;
+    while (!(months[first].number == 1 && !months[first].leap))
+    {
+        first++;
+    }
+    int index = 0;
+    for (size_t i = first; i + 1 < months.size(); i++)
+    {
+        const month &m = months[i];
+        if (m.number == 1 && !m.leap)
+        {
+            new_years.push_back(m.start);
+            lengths.push_back(0);
+            leaps.push_back(0);
+            index = 0;
+        }
+        if (months[i + 1].start - m.start == 30)
+        {
+            lengths.back() |= 1 << index;
+        }
+        if (m.leap)
+        {
+            leaps.back() = m.number;
+        }
+        index++;
+    }
+
+    int count = LAST_YEAR - FIRST_YEAR + 1;
+
+    printf("/*\n"
+           " * Generated by tables/gen_chinese.cpp, do not edit.\n"
+           " * Chinese years %d to %d.\n"
+           " */\n\n"
+           "#include \"chinese.h\"\n\n",
+           FIRST_YEAR, LAST_YEAR);
+
+    printf("// JDN of the first day of each year, and of the year after the last\n\n");
+    printf("static const int32_t chinese_new_years[%d] = {", count + 1);
+    for (int i = 0; i <= count; i++)
+    {
+        printf("%s%ld,", (i % VALUES_PER_LINE) ? " " : "\n    ", static_cast<long>(new_years[i]));
+    }
+    printf("\n};\n\n");
+
+    printf("// Bit i set if month i of the year (counting a leap month) has 30 days\n\n");
+    printf("static const uint16_t chinese_month_lengths[%d] = {", count);
+    for (int i = 0; i < count; i++)
+    {
+        printf("%s0x%04lX,", (i % VALUES_PER_LINE) ? " " : "\n    ", static_cast<unsigned long>(lengths[i]));
+    }
+    printf("\n};\n\n");
+
+    printf("// Month followed by a leap month, 0 if none\n\n");
+    printf("static const uint8_t chinese_leap_months[%d] = {", count);
+    for (int i = 0; i < count; i++)
+    {
+        printf("%s%ld,", (i % VALUES_PER_LINE) ? " " : "\n    ", static_cast<long>(leaps[i]));
+    }
+    printf("\n};\n\n");
+
+    printf("const chinese_table chinese_years = {\n");
+    printf("    %d, %d,\n", FIRST_YEAR, count);
+    printf("    chinese_new_years,\n    chinese_month_lengths,\n    chinese_leap_months,\n};\n");
+
+    return 0;
+}
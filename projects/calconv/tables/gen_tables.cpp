@@ -0,0 +1,123 @@
+/*
+ *--------------------------------------
+ * Program Name: CALCONV
+ * Author: Tomi Chen
+ * License: MIT
+ * Description: Generate src/year_table_data.cpp.
+ *
+ * Runs on the host against the arithmetic integer kernel (built with
+ * CALCONV_NO_YEAR_TABLES) and prints the start-of-year tables for every
+ * year touching 1 BCE to 2500 CE.
+ *--------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "calendar_int.h"
+#include "year_table.h"
+
+#define VALUES_PER_LINE 12
+
+struct calendar
+{
+    const char *name;
+    int32_t (*year_start)(int32_t year);
+    void (*from_jdn)(int32_t jdn, int32_t result[3]);
+    int32_t min_year;
+};
+
+static int32_t hebrew_year_start(int32_t year) { return hebrew_to_jdn(year, 7, 1); }
+static int32_t islamic_year_start(int32_t year) { return islamic_to_jdn(year, 1, 1); }
+static int32_t persian_year_start(int32_t year) { return persian_to_jdn(year, 1, 1); }
+static int32_t indian_civil_year_start(int32_t year) { return indian_civil_to_jdn(year, 1, 1); }
+
+// Persian years skip 0, so that table starts at year 1 (622 CE)
+static const calendar calendars[] = {
+    {"hebrew", hebrew_year_start, jdn_to_hebrew, INT32_MIN},
+    {"islamic", islamic_year_start, jdn_to_islamic, INT32_MIN},
+    {"persian", persian_year_start, jdn_to_persian, 1},
+    {"indian_civil", indian_civil_year_start, jdn_to_indian_civil, INT32_MIN},
+};
+
+static void print_table(const calendar &cal, int32_t first_jdn, int32_t last_jdn)
+{
+    int32_t date[3];
+
+    cal.from_jdn(first_jdn, date);
+    int32_t first_year = (date[0] < cal.min_year) ? cal.min_year : date[0];
+    cal.from_jdn(last_jdn, date);
+    int32_t last_year = date[0];
+    int count = last_year - first_year + 1;
+
+    int32_t *starts = static_cast<int32_t *>(malloc((count + 1) * sizeof(int32_t)));
+    int32_t min_length = INT32_MAX, max_length = 0;
+    for (int i = 0; i <= count; i++)
+    {
+        starts[i] = cal.year_start(first_year + i);
+        if (i > 0)
+        {
+            int32_t length = starts[i] - starts[i - 1];
+            min_length = (length < min_length) ? length : min_length;
+            max_length = (length > max_length) ? length : max_length;
+        }
+    }
+    int bits = (max_length - min_length <= 1) ? 1 : 8;
+
+    int checkpoint_count = (count + YEAR_TABLE_STRIDE - 1) / YEAR_TABLE_STRIDE;
+    printf("static const int32_t %s_checkpoints[%d] = {", cal.name, checkpoint_count);
+    for (int i = 0; i < checkpoint_count; i++)
+    {
+        printf("%s%ld,", (i % VALUES_PER_LINE) ? " " : "\n    ", static_cast<long>(starts[i * YEAR_TABLE_STRIDE]));
+    }
+    printf("\n};\n\n");
+
+    int byte_count = (bits == 8) ? count : (count + 7) / 8;
+    printf("static const uint8_t %s_lengths[%d] = {", cal.name, byte_count);
+    for (int i = 0; i < byte_count; i++)
+    {
+        unsigned value = 0;
+        if (bits == 8)
+        {
+            value = starts[i + 1] - starts[i] - min_length;
+        }
+        else
+        {
+            for (int bit = 0; bit < 8 && i * 8 + bit < count; bit++)
+            {
+                int year = i * 8 + bit;
+                value |= (starts[year + 1] - starts[year] - min_length) << bit;
+            }
+        }
+        printf("%s%u,", (i % VALUES_PER_LINE) ? " " : "\n    ", value);
+    }
+    printf("\n};\n\n");
+
+    printf("const year_table %s_year_table = {\n", cal.name);
+    printf("    %ld, %ld, %ld, %d, %d,\n", static_cast<long>(first_year), static_cast<long>(starts[count]),
+           static_cast<long>(min_length), bits, checkpoint_count);
+    printf("    %s_checkpoints,\n    %s_lengths,\n};\n", cal.name, cal.name);
+
+    free(starts);
+}
+
+int main(void)
+{
+    int32_t first_jdn = gregorian_to_jdn(0, 1, 1);
+    int32_t last_jdn = gregorian_to_jdn(2501, 1, 1) - 1;
+
+    printf("/*\n"
+           " * Generated by tables/gen_tables.cpp, do not edit.\n"
+           " * Years touching JDN %ld (1 BCE) to %ld (2500 CE).\n"
+           " */\n\n"
+           "#include \"year_table.h\"\n",
+           static_cast<long>(first_jdn), static_cast<long>(last_jdn));
+
+    for (const calendar &cal : calendars)
+    {
+        printf("\n// %s\n\n", cal.name);
+        print_table(cal, first_jdn, last_jdn);
+    }
+
+    return 0;
+}
@@ -0,0 +1,320 @@
+/*
+ *--------------------------------------
+ * Program Name: CALCUI
+ * Author: Tomi Chen
+ * License: MIT
+ * Description: Native calendar converter.
+ *
+ * The date being typed is converted to every calendar on each keystroke,
+ * through the same fan-out conversion ZCALCONV uses, so nothing has to be
+ * launched between the input and the results.
+ *
+ * LEFT/RIGHT pick the input calendar, UP/DOWN the field, the number keys,
+ * (-), . and DEL edit it, and CLEAR quits. Switching calendars fills the
+ * fields with the current date in the new calendar.
+ *--------------------------------------
+ */
+
+#include <graphx.h>
+#include <keypadc.h>
+#include <string.h>
+#include <ti/real.h>
+
+#include "calendar.h"
+#include "convert.h"
+
+#define FIELD_LENGTH 12
+#define TI_NEGATIVE '\x1A'
+
+#define TEXT_COLOR 0
+#define BACKGROUND_COLOR 255
+#define LINE_HEIGHT 12
+#define VALUE_X 104
+
+static const char *const jd_labels[] = {"JD"};
+static const char *const ymd_labels[] = {"Year", "Month", "Day"};
+static const char *const long_count_labels[] = {"Baktun", "Katun", "Tun", "Uinal", "Kin"};
+static const char *const chinese_labels[] = {"Year", "Month", "Leap", "Day"};
+
+// Input calendars in the order LEFT/RIGHT cycle through them. A Julian Day
+// is entered through selection 1, which reads a JD, and every calendar
+// through its to-JD selection; row is its row in jd_to_all, -1 for the JD.
+
+struct source
+{
+    const char *name;
+    int24_t selection;
+    int8_t row;
+    const char *const *labels;
+};
+
+static const source sources[] = {
+    {"Julian Day", 1, -1, jd_labels},
+    {"Gregorian", 0, 0, ymd_labels},
+    {"Julian", 2, 1, ymd_labels},
+    {"Hebrew", 4, 2, ymd_labels},
+    {"Islamic", 6, 3, ymd_labels},
+    {"Persian", 8, 4, ymd_labels},
+    {"Mayan", 10, 5, long_count_labels},
+    {"Indian Civil", 12, 6, ymd_labels},
+    {"Chinese", 14, 7, chinese_labels},
+};
+
+#define SOURCE_COUNT (sizeof sources / sizeof sources[0])
+
+static const char *const calendar_names[ALL_CALENDARS] = {
+    "Gregorian", "Julian", "Hebrew", "Islamic", "Persian", "Mayan", "Indian Civil", "Chinese",
+};
+
+static const kb_lkey_t digit_keys[10] = {
+    kb_Key0, kb_Key1, kb_Key2, kb_Key3, kb_Key4, kb_Key5, kb_Key6, kb_Key7, kb_Key8, kb_Key9,
+};
+
+static uint8_t source_index;
+static uint8_t field;
+static char fields[MAX_SELECTION_INPUTS][FIELD_LENGTH + 1];
+
+// The JD followed by every calendar, as from a fan-out selection
+static real_t results[MAX_SELECTION_OUTPUTS];
+
+// Keys held at the previous scan (groups 1-7), so a key only acts when it
+// goes down
+static uint8_t previous[8];
+
+static bool pressed(kb_lkey_t key)
+{
+    return kb_IsDown(key) && !(previous[key >> 8] & key);
+}
+
+static bool keys_changed(void)
+{
+    for (uint8_t group = 1; group < 8; group++)
+    {
+        if (previous[group] != static_cast<uint8_t>(kb_Data[group]))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void remember_keys(void)
+{
+    for (uint8_t group = 1; group < 8; group++)
+    {
+        previous[group] = kb_Data[group];
+    }
+}
+
+static uint8_t field_count(void)
+{
+    return selection_inputs(sources[source_index].selection);
+}
+
+static void convert_fields(void)
+{
+    real_t in[MAX_SELECTION_INPUTS];
+    for (uint8_t i = 0; i < field_count(); i++)
+    {
+        in[i] = os_StrToReal(fields[i], NULL);
+    }
+    convert_values(FAN_OUT_SELECTION + sources[source_index].selection, in, results);
+}
+
+// Start of a jd_to_all row within results
+static const real_t *result_row(uint8_t row)
+{
+    const real_t *values = &results[1];
+    for (uint8_t i = 0; i < row; i++)
+    {
+        values += all_calendar_widths[i];
+    }
+    return values;
+}
+
+// Refill the fields with the current date in the newly selected calendar
+static void load_fields(void)
+{
+    const source *input = &sources[source_index];
+    const real_t *values = (input->row < 0) ? &results[0] : result_row(input->row);
+    for (uint8_t i = 0; i < field_count(); i++)
+    {
+        os_RealToStr(fields[i], &values[i], FIELD_LENGTH, 1, -1);
+        // The OS writes its own negative sign, but (-) edits an ASCII '-'
+        for (char *c = fields[i]; (c = strchr(c, TI_NEGATIVE)); c++)
+        {
+            *c = '-';
+        }
+    }
+    field = 0;
+}
+
+// Returns whether the field changed
+
+static bool edit_field(void)
+{
+    char *text = fields[field];
+    size_t length = strlen(text);
+    char typed = '\0';
+
+    for (uint8_t digit = 0; digit < 10; digit++)
+    {
+        if (pressed(digit_keys[digit]))
+        {
+            typed = '0' + digit;
+        }
+    }
+    // Only a Julian Day has a fraction
+    if (pressed(kb_KeyDecPnt) && sources[source_index].row < 0 && !strchr(text, '.'))
+    {
+        typed = '.';
+    }
+
+    if (typed)
+    {
+        if (length == FIELD_LENGTH)
+        {
+            return false;
+        }
+        text[length] = typed;
+        text[length + 1] = '\0';
+        return true;
+    }
+    if (pressed(kb_KeyChs))
+    {
+        if (text[0] == '-')
+        {
+            memmove(text, text + 1, length);
+            return true;
+        }
+        if (length == FIELD_LENGTH)
+        {
+            return false;
+        }
+        memmove(text + 1, text, length + 1);
+        text[0] = '-';
+        return true;
+    }
+    if (pressed(kb_KeyDel) && length)
+    {
+        text[length - 1] = '\0';
+        return true;
+    }
+    return false;
+}
+
+static void print_values(const real_t *values, uint8_t count, int y)
+{
+    char str[16];
+    gfx_SetTextXY(VALUE_X, y);
+    for (uint8_t i = 0; i < count; i++)
+    {
+        os_RealToStr(str, &values[i], 0, 1, -1);
+        gfx_PrintString(str);
+        gfx_PrintString(" ");
+    }
+}
+
+static void draw(void)
+{
+    const source *input = &sources[source_index];
+    int y = 4;
+
+    gfx_FillScreen(BACKGROUND_COLOR);
+    gfx_PrintStringXY("From:", 4, y);
+    gfx_PrintStringXY("<", VALUE_X - 12, y);
+    gfx_PrintStringXY(input->name, VALUE_X, y);
+    gfx_PrintString(" >");
+    y += LINE_HEIGHT + 4;
+
+    for (uint8_t i = 0; i < field_count(); i++)
+    {
+        if (i == field)
+        {
+            gfx_PrintStringXY(">", 4, y);
+        }
+        gfx_PrintStringXY(input->labels[i], 16, y);
+        gfx_PrintStringXY(fields[i], VALUE_X, y);
+        if (i == field)
+        {
+            gfx_PrintString("_");
+        }
+        y += LINE_HEIGHT;
+    }
+
+    y = 4 + (LINE_HEIGHT + 4) + MAX_SELECTION_INPUTS * LINE_HEIGHT + 4;
+    gfx_HorizLine(4, y - 4, GFX_LCD_WIDTH - 8);
+    gfx_PrintStringXY("Julian Day", 4, y);
+    print_values(&results[0], 1, y);
+    for (uint8_t row = 0; row < ALL_CALENDARS; row++)
+    {
+        y += LINE_HEIGHT;
+        gfx_PrintStringXY(calendar_names[row], 4, y);
+        print_values(result_row(row), all_calendar_widths[row], y);
+    }
+
+    gfx_PrintStringXY("arrows: move   clear: quit", 4, GFX_LCD_HEIGHT - LINE_HEIGHT);
+    gfx_SwapDraw();
+}
+
+int main(void)
+{
+    // Start on 2000-01-01 in the Gregorian calendar
+    source_index = 1;
+    strcpy(fields[0], "2000");
+    strcpy(fields[1], "1");
+    strcpy(fields[2], "1");
+    convert_fields();
+
+    gfx_Begin();
+    gfx_SetDrawBuffer();
+    gfx_SetTextFGColor(TEXT_COLOR);
+    gfx_SetTextBGColor(BACKGROUND_COLOR);
+    gfx_SetColor(TEXT_COLOR);
+    draw();
+
+    for (;;)
+    {
+        kb_Scan();
+        if (kb_IsDown(kb_KeyClear))
+        {
+            break;
+        }
+
+        if (keys_changed())
+        {
+            bool redraw = true;
+            if (pressed(kb_KeyLeft) || pressed(kb_KeyRight))
+            {
+                source_index = pressed(kb_KeyLeft) ? (source_index + SOURCE_COUNT - 1) % SOURCE_COUNT
+                                                   : (source_index + 1) % SOURCE_COUNT;
+                load_fields();
+            }
+            else if (pressed(kb_KeyUp))
+            {
+                field = (field + field_count() - 1) % field_count();
+            }
+            else if (pressed(kb_KeyDown))
+            {
+                field = (field + 1) % field_count();
+            }
+            else if (edit_field())
+            {
+                convert_fields();
+            }
+            else
+            {
+                redraw = false;
+            }
+
+            remember_keys();
+            if (redraw)
+            {
+                draw();
+            }
+        }
+    }
+
+    gfx_End();
+    return 0;
+}
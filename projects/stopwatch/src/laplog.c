@@ -0,0 +1,174 @@
+#include <fileioc.h>
+#include <stdlib.h>
+#include <ti/vars.h>
+
+#include "laplog.h"
+
+/* Each signal's fire time and lateness, as in signal_t */
+#define SIGNAL_SIZE (2 * sizeof(uint32_t))
+
+/* The version and signal count bytes come before the signals */
+#define SIGNALS_START 2
+#define LAPS_START (SIGNALS_START + SIGNAL_COUNT * SIGNAL_SIZE)
+
+static uint8_t log_handle;
+static uint24_t laps_written;
+static uint24_t laps_room;
+
+void laplog_Open(void)
+{
+    static const uint8_t header[SIGNALS_START] = {LAPLOG_VERSION, SIGNAL_COUNT};
+
+    laps_written = laps_room = 0;
+    log_handle = ti_Open(LAPLOG_APPVAR, "w");
+    if (!log_handle)
+    {
+        return;
+    }
+
+    bool written = ti_Write(header, SIGNALS_START, 1, log_handle) == 1;
+#if SIGNAL_COUNT != 0
+    /* Signals that don't fire stay zero */
+    static const uint8_t unfired[SIGNAL_COUNT * SIGNAL_SIZE] = {0};
+    written = written && ti_Write(unfired, sizeof(unfired), 1, log_handle) == 1;
+#endif
+
+    /* Make room for the first chunk before the timer starts */
+    if (!written ||
+        ti_Resize(LAPS_START + LAPLOG_CHUNK * sizeof(uint32_t), log_handle) <= 0)
+    {
+        ti_Close(log_handle);
+        log_handle = 0;
+        return;
+    }
+    laps_room = LAPLOG_CHUNK;
+}
+
+void laplog_Append(uint32_t ticks)
+{
+    if (!log_handle)
+    {
+        return;
+    }
+
+    /* Only every LAPLOG_CHUNK laps does the AppVar have to grow */
+    if (laps_written == laps_room)
+    {
+        if (ti_Resize(LAPS_START + (laps_room + LAPLOG_CHUNK) * sizeof(uint32_t), log_handle) <= 0)
+        {
+            return;
+        }
+        laps_room += LAPLOG_CHUNK;
+    }
+
+    ti_Seek(LAPS_START + laps_written * sizeof(uint32_t), SEEK_SET, log_handle);
+    if (ti_Write(&ticks, sizeof(uint32_t), 1, log_handle) == 1)
+    {
+        laps_written++;
+    }
+}
+
+void laplog_Signal(uint8_t index, const signal_t *signal)
+{
+#if SIGNAL_COUNT != 0
+    if (!log_handle || index >= SIGNAL_COUNT)
+    {
+        return;
+    }
+
+    ti_Seek(SIGNALS_START + index * SIGNAL_SIZE, SEEK_SET, log_handle);
+    ti_Write(&signal->fired, sizeof(uint32_t), 1, log_handle);
+    ti_Write(&signal->late, sizeof(int32_t), 1, log_handle);
+#else
+    (void)index;
+    (void)signal;
+#endif
+}
+
+void laplog_Close(void)
+{
+    if (!log_handle)
+    {
+        return;
+    }
+
+    ti_Resize(LAPS_START + laps_written * sizeof(uint32_t), log_handle);
+    ti_Close(log_handle);
+    log_handle = 0;
+}
+
+/* ticks in seconds, rounded to 0.1 ms, built digit by digit since the
+   value can have more digits than a float holds */
+static real_t TicksToReal(uint32_t ticks)
+{
+    real_t result = {0, (int8_t)0x80, {0}};
+    uint32_t value = (ticks / TICKS_PER_SECOND) * 10000 +
+                     ((ticks % TICKS_PER_SECOND) * 10000 + TICKS_PER_SECOND / 2) / TICKS_PER_SECOND;
+    uint8_t digits[10];
+    uint8_t count = 0;
+
+    for (; value != 0; value /= 10)
+    {
+        digits[count++] = value % 10;
+    }
+    if (count == 0)
+    {
+        return result;
+    }
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        uint8_t digit = digits[count - 1 - i];
+        result.mant[i / 2] |= (i & 1) ? digit : digit << 4;
+    }
+
+    /* Four of the digits are decimals */
+    result.exp = (int8_t)(0x80 + count - 1 - 4);
+    return result;
+}
+
+bool laplog_Export(void)
+{
+    uint8_t handle = ti_Open(LAPLOG_APPVAR, "r");
+    uint8_t header[SIGNALS_START];
+    bool exported = false;
+
+    if (!handle)
+    {
+        return false;
+    }
+
+    uint24_t laps = 0;
+    list_t *list = NULL;
+
+    /* Only the laps are exported, so skip over the signals */
+    if (ti_Read(header, SIGNALS_START, 1, handle) == 1 && header[0] == LAPLOG_VERSION)
+    {
+        uint24_t start = SIGNALS_START + header[1] * SIGNAL_SIZE;
+        uint24_t size = ti_GetSize(handle);
+
+        ti_Seek(start, SEEK_SET, handle);
+        laps = size > start ? (size - start) / sizeof(uint32_t) : 0;
+        if (laps > LAPLOG_LIST_MAX)
+        {
+            laps = LAPLOG_LIST_MAX;
+        }
+        list = malloc(sizeof(list_t) + laps * sizeof(real_t));
+    }
+
+    if (list)
+    {
+        list->dim = laps;
+        for (uint24_t i = 0; i < laps; i++)
+        {
+            uint32_t ticks;
+            ti_Read(&ticks, sizeof(uint32_t), 1, handle);
+            list->items[i] = TicksToReal(ticks);
+        }
+        exported = ti_SetVar(OS_TYPE_REAL_LIST, LAPLOG_LIST, list) == 0;
+    }
+
+    free(list);
+    ti_Close(handle);
+    return exported;
+}
@@ -0,0 +1,58 @@
+/*
+ * Lap log, kept in the LAPLOG AppVar so laps that scrolled off the screen
+ * aren't lost.
+ *
+ * LAPLOG starts with a version byte (LAPLOG_VERSION) and a byte giving the
+ * number of scheduled signals (SIGNAL_COUNT). Each signal then has a 4-byte
+ * tick count for when it fired and a 4-byte signed count of ticks it fired
+ * after its target (negative if early), both zero if the stopwatch was
+ * stopped before it was due. After the signals comes one 4-byte tick count
+ * per lap. The last lap is the time the stopwatch was stopped. Every value
+ * is little-endian, in ticks (1/32768 s) and drift corrected. Each run
+ * replaces the log of the previous one.
+ *
+ * The AppVar is grown LAPLOG_CHUNK laps at a time, so appending a lap is
+ * normally a copy into space that already exists rather than the OS
+ * moving memory around to make room while the stopwatch is running.
+ *
+ * The AppVar and the list are written through fileioc, the one CE library
+ * STPWTCH needs (and so LibLoad).
+ */
+
+#ifndef LAPLOG_H
+#define LAPLOG_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "timing.h"
+
+#define LAPLOG_APPVAR "LAPLOG"
+#define LAPLOG_VERSION 2
+
+#define LAPLOG_CHUNK 512
+
+/* Custom list the log is exported to, in seconds to 0.1 ms */
+#define LAPLOG_LIST "\x5D" "LAPS"
+
+/* The most elements a list can hold; only the first this many laps of a */
+/* longer log are exported, and the rest are only in the AppVar */
+#define LAPLOG_LIST_MAX 999
+
+/* Start a new log; laps aren't logged if there is no room for it */
+void laplog_Open(void);
+
+/* Add a lap to the log */
+void laplog_Append(uint32_t ticks);
+
+/* Record signal number index (from 0) in the log */
+void laplog_Signal(uint8_t index, const signal_t *signal);
+
+/* Trim the log to the laps written and close it */
+void laplog_Close(void);
+
+/* Copy up to LAPLOG_LIST_MAX laps of the log to LAPLOG_LIST, returning
+   false if there is no log or not enough memory for the list */
+bool laplog_Export(void);
+
+#endif
@@ -1,28 +1,120 @@
 #include <ti/getcsc.h>
 #include <ti/screen.h>
-#include <ti/real.h>
-#include <sys/timers.h>
-#include <time.h>
+#include <string.h>
+
+#include "laplog.h"
+#include "timing.h"
+
+/* The running time is shown in hundredths, laps and the final time */
+/* to LAP_DECIMALS places (up to 4, since a tick is about 0.03 ms) */
+#define RUNNING_DECIMALS 2
+#define LAP_DECIMALS STOPWATCH_LAP_DECIMALS
+
+/* Max stopwatch value is (2^32 - 1) / 32768 = 131072.0000, */
+/* which is 11 characters */
+#define TIME_CHARS 11
+
+/* What is on screen at the end of the row being updated, so each frame */
+/* only reprints the characters that changed */
+static char shown[TIME_CHARS + 1];
+static uint8_t shown_row = UINT8_MAX;
+
+/* Write ticks as seconds with the given number of decimals, rounded, */
+/* without leading zeros */
+static void FormatTime(uint32_t ticks, uint8_t decimals, char *str)
+{
+    uint32_t scale = 1;
+    char digits[TIME_CHARS];
+    uint8_t count = 0;
+
+    for (uint8_t i = 0; i < decimals; i++)
+    {
+        scale *= 10;
+    }
+
+    /* A tick is 1/32768 s, so the fraction times 10^4 still fits in 32 bits. */
+    /* Whole seconds fit in a native int. */
+    unsigned int seconds = ticks / TICKS_PER_SECOND;
+    uint32_t fraction =
+        ((ticks % TICKS_PER_SECOND) * scale + TICKS_PER_SECOND / 2) / TICKS_PER_SECOND;
+
+    if (fraction == scale)
+    {
+        fraction = 0;
+        seconds++;
+    }
+
+    for (uint8_t i = 0; i < decimals; i++)
+    {
+        digits[count++] = '0' + fraction % 10;
+        fraction /= 10;
+    }
+    if (decimals != 0)
+    {
+        digits[count++] = '.';
+    }
+    do
+    {
+        digits[count++] = '0' + seconds % 10;
+        seconds /= 10;
+    } while (seconds != 0);
+
+    while (count != 0)
+    {
+        *str++ = digits[--count];
+    }
+    *str = '\0';
+}
 
 /* Print a stopwatch value on the home screen */
-static void PrintTime(float elapsed, uint8_t row)
+static void PrintTime(uint32_t ticks, uint8_t decimals, uint8_t row)
 {
-    /* Float format for printf may be unimplemented, so go through an OS real */
-    real_t elapsed_real;
+    char str[TIME_CHARS + 1];
+    uint8_t first = 0;
+    uint8_t length;
 
-    /* Max stopwatch value is (2^32 - 1) / 32768 = 131072.00, */
-    /* so create a buffer with room for 9 characters plus a null terminator */
-    char str[10];
+    FormatTime(ticks, decimals, str);
 
-    /* If the elapsed time is small enough that the OS would print it using */
-    /* scientific notation, force it down to zero before conversion */
-    elapsed_real = os_FloatToReal(elapsed <= 0.001f ? 0.0f : elapsed);
+    /* Pad to the full width, so a shorter time clears whatever was there */
+    /* before, such as an older lap after the rows wrap around */
+    for (length = strlen(str); length < TIME_CHARS; length++)
+    {
+        str[length] = ' ';
+    }
+    str[TIME_CHARS] = '\0';
 
-    /* Convert the elapsed time real to a string */
-    os_RealToStr(str, &elapsed_real, 8, 1, 2);
+    /* Nothing on a new row is known to match */
+    if (row != shown_row)
+    {
+        shown_row = row;
+        shown[0] = '\0';
+    }
+
+    /* Usually only the last digit or two changed since the last frame */
+    while (str[first] != '\0' && str[first] == shown[first])
+    {
+        first++;
+    }
+    if (str[first] == '\0')
+    {
+        return;
+    }
+
+    os_SetCursorPos(row, first);
+    os_PutStrFull(str + first);
+    strcpy(shown, str);
+}
+
+/* Signals are logged to the right of the laps, one row each */
+#define SIGNAL_COLUMN 13
+
+/* Print when a signal actually fired, to 0.1 ms */
+static void PrintSignal(const signal_t *signal, uint8_t index)
+{
+    char str[TIME_CHARS + 1];
 
-    /* print the string */
-    os_SetCursorPos(row, 0);
+    FormatTime(signal->fired, 4, str);
+    os_SetCursorPos(index, SIGNAL_COLUMN);
     os_PutStrFull(str);
 }
 
@@ -32,34 +124,51 @@ int main(void)
     os_ClrHome();
 
     uint8_t row = 0;
+    uint8_t signals = 0;
 
     /* Display an initial time of zero */
-    PrintTime(0.0f, row);
+    PrintTime(0, RUNNING_DECIMALS, row);
 
-    /* Wait for a key press */
-    while (!os_GetCSC())
-        ;
+    /* Get the log ready before the timer starts */
+    laplog_Open();
 
-    /* Record the start time */
-    clock_t start = clock();
+    /* Wait for a key press, which starts the timer */
+    timing_Start();
 
-    /* Continue running until a key is pressed */
+    /* Continue running until clear is pressed */
     while (true)
     {
-        /* Calculate and print the elapsed time */
-        clock_t now = clock();
-        float elapsed = (float)(now - start) / CLOCKS_PER_SEC;
-        PrintTime(elapsed, row);
-        uint8_t key = os_GetCSC();
-        if (key == sk_Clear)
+        lap_t lap;
+        signal_t signal;
+
+        timing_Poll();
+        if (timing_TakeLap(&lap))
         {
-            break;
+            /* Show the time the key went down, then move to the next row */
+            PrintTime(lap.ticks, LAP_DECIMALS, row);
+            laplog_Append(lap.ticks);
+            if (lap.stop)
+            {
+                break;
+            }
+            row = (row + 1) % 10;
         }
-        else if (key != 0)
+        else if (timing_TakeSignal(&signal))
         {
-            row = (row + 1) % 10;
+            laplog_Signal(signals, &signal);
+            PrintSignal(&signal, signals++);
         }
-    };
+        else if (timing_FrameDue())
+        {
+            /* Calculate and print the elapsed time */
+            PrintTime(timing_Now(), RUNNING_DECIMALS, row);
+        }
+    }
+
+    timing_End();
+
+    laplog_Close();
+    laplog_Export();
 
     /* Wait for a key */
     while (!os_GetCSC())
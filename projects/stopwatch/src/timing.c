@@ -0,0 +1,293 @@
+#include <keypadc.h>
+#include <sys/lcd.h>
+#include <sys/timers.h>
+
+#ifdef STOPWATCH_CAPTURE_INTERRUPT
+#define FORCE_INTERRUPTS
+#include <intce.h>
+#endif
+
+#include "timing.h"
+
+/* Power of two, so the indices can wrap with a mask */
+#define LAP_QUEUE_SIZE 16
+
+static volatile lap_t queue[LAP_QUEUE_SIZE];
+static volatile uint8_t queue_head;
+static volatile uint8_t queue_tail;
+
+/* Keys held at the last look, per keypad group */
+static uint8_t held[8];
+
+/* Keypad controller settings to hand back to the OS. Only the register */
+/* macros in keypadc.h are used, so the keypadc library isn't needed. */
+static uint8_t saved_config;
+static uint8_t saved_enable;
+
+#if SIGNAL_COUNT != 0
+/* Bits per pixel in lcd_Control */
+#define LCD_BPP_MASK (7 << 1)
+#define LCD_BPP_8 (3 << 1)
+
+/* Signals are logged by the match handler and taken by the main loop */
+static volatile uint32_t signal_fired[SIGNAL_COUNT];
+static volatile uint8_t signals_fired;
+static uint8_t signals_taken;
+static volatile bool flashing;
+
+static uint24_t saved_control;
+static uint16_t saved_palette[256];
+#endif
+
+/* DRIFT_PPM parts per million of ticks, without overflowing 32 bits */
+static int32_t Drift(uint32_t ticks)
+{
+#if STOPWATCH_DRIFT_PPM != 0
+    return (int32_t)(ticks / 1000000) * STOPWATCH_DRIFT_PPM +
+           (int32_t)(ticks % 1000000) * STOPWATCH_DRIFT_PPM / 1000000;
+#else
+    (void)ticks;
+    return 0;
+#endif
+}
+
+static uint32_t CorrectDrift(uint32_t ticks)
+{
+    return ticks - Drift(ticks);
+}
+
+#if SIGNAL_COUNT != 0
+/* Timer value when signal number index (from 0) is due */
+static uint32_t SignalDue(uint8_t index)
+{
+    uint32_t target = (uint32_t)(index + 1) * SIGNAL_TICKS;
+    return target + Drift(target);
+}
+
+/* Timer 2 reached match 2, which is either the next signal or the end of
+   the flash for the last one */
+static void SignalMatch(void)
+{
+    if (!flashing)
+    {
+        /* Every palette entry is black, so showing the screen at 8 bits
+           per pixel blanks it at once without touching its contents */
+        lcd_Control = (saved_control & ~LCD_BPP_MASK) | LCD_BPP_8;
+        uint32_t now = timer_GetSafe(2, TIMER_UP);
+
+        signal_fired[signals_fired] = now;
+        signals_fired++;
+        timer_SetMatch(2, 2, now + FLASH_TICKS);
+        flashing = true;
+    }
+    else
+    {
+        lcd_Control = saved_control;
+        if (signals_fired < SIGNAL_COUNT)
+        {
+            timer_SetMatch(2, 2, SignalDue(signals_fired));
+        }
+        flashing = false;
+    }
+}
+#endif
+
+/* Read the keypad and return the newly pressed keys of each group in
+   pressed, or false if nothing went down */
+static bool ScanKeys(uint8_t pressed[8])
+{
+    bool any = false;
+
+    for (uint8_t group = 1; group < 8; group++)
+    {
+        uint8_t keys = kb_Data[group];
+        pressed[group] = keys & ~held[group];
+        held[group] = keys;
+        any |= pressed[group] != 0;
+    }
+
+    return any;
+}
+
+static void CaptureKeys(void)
+{
+    uint32_t now = timer_GetSafe(2, TIMER_UP);
+    uint8_t pressed[8];
+
+    if (!ScanKeys(pressed))
+    {
+        return;
+    }
+
+    /* Drop the press if the display has fallen a whole queue behind */
+    uint8_t next = (queue_head + 1) & (LAP_QUEUE_SIZE - 1);
+    if (next == queue_tail)
+    {
+        return;
+    }
+
+    queue[queue_head].ticks = now;
+    queue[queue_head].stop = (pressed[6] & kb_Clear) != 0;
+    queue_head = next;
+}
+
+#ifdef STOPWATCH_CAPTURE_INTERRUPT
+static void __attribute__((interrupt)) KeypadInterrupt(void)
+{
+    CaptureKeys();
+    kb_IntAcknowledge = KB_DATA_CHANGED;
+    int_Acknowledge = INT_KEYBOARD;
+}
+
+#if SIGNAL_COUNT != 0
+static void __attribute__((interrupt)) TimerInterrupt(void)
+{
+    timer_AckInterrupt(2, TIMER_MATCH(2));
+    SignalMatch();
+    int_Acknowledge = INT_TIMER2;
+}
+#endif
+#endif
+
+void timing_Start(void)
+{
+    uint8_t pressed[8];
+
+    /* Scan the keypad continuously so kb_Data is always current */
+    saved_config = kb_Config;
+    saved_enable = kb_EnableInt;
+    kb_SetMode(MODE_3_CONTINUOUS);
+
+    /* A key still held from launching the program doesn't count */
+    ScanKeys(pressed);
+    while (!ScanKeys(pressed))
+        ;
+
+#if SIGNAL_COUNT != 0
+    saved_control = lcd_Control;
+    for (uint24_t i = 0; i < 256; i++)
+    {
+        saved_palette[i] = lcd_Palette[i];
+        lcd_Palette[i] = 0;
+    }
+    signals_fired = signals_taken = 0;
+    flashing = false;
+#endif
+
+    timer_Disable(2);
+    timer_Set(2, 0);
+    timer_SetMatch(2, 1, FRAME_TICKS);
+    timer_AckInterrupt(2, TIMER_MATCH(1));
+#if SIGNAL_COUNT != 0
+    timer_SetMatch(2, 2, SignalDue(0));
+    timer_AckInterrupt(2, TIMER_MATCH(2));
+#endif
+    timer_Enable(2, TIMER_32K, TIMER_NOINT, TIMER_UP);
+
+    queue_head = queue_tail = 0;
+
+#ifdef STOPWATCH_CAPTURE_INTERRUPT
+    int_Initialize();
+    int_SetVector(KEYBOARD_IVECT, KeypadInterrupt);
+    kb_IntAcknowledge = KB_DATA_CHANGED;
+    kb_EnableInt = KB_DATA_CHANGED;
+#if SIGNAL_COUNT != 0
+    int_SetVector(TIMER2_IVECT, TimerInterrupt);
+    timer_EnableInt = TIMER2_MATCH2;
+    int_EnableConfig = INT_KEYBOARD | INT_TIMER2;
+#else
+    int_EnableConfig = INT_KEYBOARD;
+#endif
+    int_Enable();
+#endif
+}
+
+void timing_End(void)
+{
+#ifdef STOPWATCH_CAPTURE_INTERRUPT
+    int_Disable();
+    kb_EnableInt = 0;
+    timer_EnableInt = 0;
+    int_Reset();
+#endif
+
+    timer_Disable(2);
+
+#if SIGNAL_COUNT != 0
+    lcd_Control = saved_control;
+    for (uint24_t i = 0; i < 256; i++)
+    {
+        lcd_Palette[i] = saved_palette[i];
+    }
+#endif
+
+    /* Let go of every key first, so the OS doesn't see the last one again */
+    do
+    {
+        uint8_t pressed[8];
+        ScanKeys(pressed);
+    } while (held[1] | held[2] | held[3] | held[4] | held[5] | held[6] | held[7]);
+
+    kb_EnableInt = saved_enable;
+    kb_Config = saved_config;
+}
+
+uint32_t timing_Now(void)
+{
+    return CorrectDrift(timer_GetSafe(2, TIMER_UP));
+}
+
+void timing_Poll(void)
+{
+#ifndef STOPWATCH_CAPTURE_INTERRUPT
+#if SIGNAL_COUNT != 0
+    if (timer_ChkInterrupt(2, TIMER_MATCH(2)))
+    {
+        timer_AckInterrupt(2, TIMER_MATCH(2));
+        SignalMatch();
+    }
+#endif
+    CaptureKeys();
+#endif
+}
+
+bool timing_TakeLap(lap_t *lap)
+{
+    if (queue_tail == queue_head)
+    {
+        return false;
+    }
+
+    lap->ticks = CorrectDrift(queue[queue_tail].ticks);
+    lap->stop = queue[queue_tail].stop;
+    queue_tail = (queue_tail + 1) & (LAP_QUEUE_SIZE - 1);
+    return true;
+}
+
+bool timing_FrameDue(void)
+{
+    if (!timer_ChkInterrupt(2, TIMER_MATCH(1)))
+    {
+        return false;
+    }
+
+    timer_AckInterrupt(2, TIMER_MATCH(1));
+    timer_SetMatch(2, 1, timer_GetSafe(2, TIMER_UP) + FRAME_TICKS);
+    return true;
+}
+
+bool timing_TakeSignal(signal_t *signal)
+{
+#if SIGNAL_COUNT != 0
+    if (signals_taken != signals_fired)
+    {
+        signal->fired = CorrectDrift(signal_fired[signals_taken]);
+        signal->late = (int32_t)(signal->fired - (uint32_t)(signals_taken + 1) * SIGNAL_TICKS);
+        signals_taken++;
+        return true;
+    }
+#else
+    (void)signal;
+#endif
+    return false;
+}
@@ -0,0 +1,80 @@
+/*
+ * Stopwatch timing and lap capture.
+ *
+ * Time is kept by hardware timer 2 counting up at 32768 Hz from the key
+ * press that starts the stopwatch. Every later key press is stamped with
+ * the timer as soon as it is seen and queued, so the time recorded for a
+ * lap doesn't depend on how long the display takes to draw.
+ *
+ * With CAPTURE = INTERRUPT in the makefile, presses are stamped by the
+ * keypad interrupt. TI broke custom interrupts on hardware revision I and
+ * later, so the default (CAPTURE = POLL) stamps them from the main loop,
+ * which only draws the display when timer 2's match register says a frame
+ * is due and otherwise just watches the keypad.
+ *
+ * The times handed out are corrected for crystal drift by DRIFT_PPM from
+ * the makefile. The RTC counts the same crystal, so it can't be used to
+ * measure the drift; compare against a reference clock instead.
+ *
+ * When SIGNAL_COUNT is set, timer 2's match register 2 also flashes the
+ * screen black every SIGNAL_INTERVAL seconds from the start, from the
+ * timer interrupt with CAPTURE = INTERRUPT or from timing_Poll otherwise,
+ * and records when each flash actually began and how far that was from
+ * when it was due.
+ */
+
+#ifndef TIMING_H
+#define TIMING_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define TICKS_PER_SECOND 32768
+
+/* The running time is redrawn 32 times a second */
+#define FRAME_TICKS (TICKS_PER_SECOND / 32)
+
+/* Scheduled signals, one per row of the home screen at most */
+#define SIGNAL_COUNT STOPWATCH_SIGNAL_COUNT
+#define SIGNAL_TICKS ((uint32_t)STOPWATCH_SIGNAL_INTERVAL * TICKS_PER_SECOND)
+#define FLASH_TICKS (TICKS_PER_SECOND / 4)
+
+#if SIGNAL_COUNT > 10
+#error "SIGNAL_COUNT can be at most 10"
+#endif
+
+typedef struct
+{
+    uint32_t ticks; /* Stopwatch time when the key went down */
+    bool stop;      /* The clear key, which stops the stopwatch */
+} lap_t;
+
+typedef struct
+{
+    uint32_t fired; /* When the screen actually flashed */
+    int32_t late;   /* fired minus when it was due, negative if early */
+} signal_t;
+
+/* Wait for a key press, then start the timer at zero */
+void timing_Start(void);
+
+/* Stop capturing and hand the keypad back to the OS */
+void timing_End(void);
+
+/* Current stopwatch time in ticks, corrected for drift */
+uint32_t timing_Now(void);
+
+/* Look for key presses; does nothing when the interrupt stamps them */
+void timing_Poll(void);
+
+/* Take the oldest queued key press, returning false if there is none */
+bool timing_TakeLap(lap_t *lap);
+
+/* Take the oldest signal that fired since the last call, returning false
+   if there is none */
+bool timing_TakeSignal(signal_t *signal);
+
+/* True once every FRAME_TICKS, when the display should be redrawn */
+bool timing_FrameDue(void);
+
+#endif